@@ -0,0 +1,84 @@
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+  // constant-initialized, so it is usable from operator new before any other initialization on the thread
+  thread_local AllocationCounters counters;
+
+#ifdef RISK_ALLOC_TRACKING
+  // every block carries its size in a header, keeping the payload aligned as malloc would
+  constexpr std::size_t HEADER = alignof(std::max_align_t);
+
+  void* allocate(std::size_t size) noexcept {
+    auto* block = static_cast<unsigned char*>(std::malloc(size + HEADER));
+    if (!block) return nullptr;
+    *reinterpret_cast<std::size_t*>(block) = size;
+
+    const auto bytes = static_cast<std::int64_t>(size);
+    counters.allocations++;
+    counters.bytes += bytes;
+    counters.liveBytes += bytes;
+    counters.peakBytes = std::max(counters.peakBytes, counters.liveBytes);
+    return block + HEADER;
+  }
+
+  void* allocateOrThrow(std::size_t size) {
+    void* ptr = allocate(size);
+    while (!ptr) {
+      std::new_handler handler = std::get_new_handler();
+      if (!handler) throw std::bad_alloc();
+      handler();
+      ptr = allocate(size);
+    }
+    return ptr;
+  }
+
+  void release(void* ptr) noexcept {
+    if (!ptr) return;
+    unsigned char* block = static_cast<unsigned char*>(ptr) - HEADER;
+
+    counters.deallocations++;
+    counters.liveBytes -= static_cast<std::int64_t>(*reinterpret_cast<std::size_t*>(block));
+    std::free(block);
+  }
+#endif
+}
+
+
+// ==================== AllocationTracker Class Implementation ====================
+// --- COUNTERS ---
+AllocationCounters AllocationTracker::current() {
+  return counters;
+}
+
+std::int64_t AllocationTracker::beginPeak() {
+  const std::int64_t savedPeak = counters.peakBytes;
+  counters.peakBytes = counters.liveBytes;
+  return savedPeak;
+}
+
+std::int64_t AllocationTracker::endPeak(std::int64_t savedPeak) {
+  const std::int64_t regionPeak = counters.peakBytes;
+  counters.peakBytes = std::max(savedPeak, regionPeak);
+  return regionPeak;
+}
+
+
+// ==================== Global Allocation Functions ====================
+#ifdef RISK_ALLOC_TRACKING
+void* operator new(std::size_t size) { return allocateOrThrow(size); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void operator delete(void* ptr) noexcept { release(ptr); }
+void operator delete[](void* ptr) noexcept { release(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { release(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Heap activity of one thread since it started.
+ */
+struct AllocationCounters {
+  std::int64_t allocations = 0;
+  std::int64_t deallocations = 0;
+  std::int64_t bytes = 0;     // total bytes ever allocated
+  std::int64_t liveBytes = 0; // allocated and not yet freed (memory freed by another thread is credited there)
+  std::int64_t peakBytes = 0; // high-water mark of liveBytes
+};
+
+
+/**
+ * The AllocationTracker class counts every global operator new/delete when RISK_ALLOC_TRACKING is defined
+ * (cmake -DRISK_ALLOC_TRACKING=ON, off by default), by replacing the global allocation functions.
+ * Counters are kept per thread. Profiler scopes read them to attribute allocations, bytes and high-water marks
+ * to games, turns, phases, orders and strategies; without tracking every counter stays zero.
+ */
+class AllocationTracker {
+public:
+  static constexpr bool isEnabled() {
+#ifdef RISK_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // counters
+  static AllocationCounters current(); // this thread's counters
+
+  // high-water marks of a nested region: beginPeak restarts the mark at the current live size,
+  // endPeak returns the region's own mark and folds it back into the enclosing one
+  static std::int64_t beginPeak();
+  static std::int64_t endPeak(std::int64_t savedPeak);
+};
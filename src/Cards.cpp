@@ -1,14 +1,16 @@
 #include "Cards.h"
 #include "GameEngine.h"
+#include "Input.h"
 #include "Map.h"
 #include "Orders.h"
 #include "Player.h"
+#include "Utility.h"
 
+#include <algorithm>
 #include <iostream>
 #include <random>
 #include <vector>
 
-
 // ==================== Card Class Implementation ====================
 Card::Card() {}
 
@@ -20,9 +22,22 @@ Card& Card::operator=(const Card& other) {
 
 Card::~Card() {}
 
+// --- GETTERS ---
+const Card& Card::of(CardType type) {
+  static const BombCard bomb;
+  static const ReinforcementCard reinforcement;
+  static const BlockadeCard blockade;
+  static const AirliftCard airlift;
+  static const DiplomacyCard diplomacy;
+  static const std::array<const Card*, CARD_TYPE_COUNT> behaviours = {
+    &bomb, &reinforcement, &blockade, &airlift, &diplomacy
+  };
+  return *behaviours[static_cast<int>(type)];
+}
+
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const Card& crd) {
-  os << "Card[" << crd.getType() << "]";
+  os << "Card[" << cardTypeName(crd.getType()) << "]";
   return os;
 }
 
@@ -39,12 +54,12 @@ BombCard& BombCard::operator=(const BombCard& other) {
 BombCard::~BombCard() {}
 
 // --- GETTERS ---
-std::string BombCard::getType() const {
-  return CARD_TYPES::BOMB;
+CardType BombCard::getType() const {
+  return CardType::BOMB;
 }
 
 // --- UTILITY ---
-void BombCard::play(Player* player, OrdersList* ordersList, Deck* deck) {
+void BombCard::play(Player* player, OrdersList* ordersList) const {
   if (!player || !ordersList) return;
 
   std::cout << player->getName() << " plays Bomb Card -> create Bomb Order\n";
@@ -60,8 +75,7 @@ void BombCard::play(Player* player, OrdersList* ordersList, Deck* deck) {
   }
 
   Territory* target = chooseTerritory(attackable);
-  if (target) ordersList->addOrder(new OrderBomb(player, target));
-  if (deck) deck->addCard(new BombCard());
+  if (target) ordersList->addOrder(std::make_unique<OrderBomb>(player, target));
 }
 
 
@@ -77,18 +91,16 @@ ReinforcementCard& ReinforcementCard::operator=(const ReinforcementCard& other)
 ReinforcementCard::~ReinforcementCard() {}
 
 // --- GETTERS ---
-std::string ReinforcementCard::getType() const {
-  return CARD_TYPES::REINFORCEMENT;
+CardType ReinforcementCard::getType() const {
+  return CardType::REINFORCEMENT;
 }
 
 // --- UTILITY ---
-void ReinforcementCard::play(Player* player, OrdersList* ordersList, Deck* deck) {
+void ReinforcementCard::play(Player* player, OrdersList* ordersList) const {
   if (!player) return;
 
   std::cout << player->getName() << " plays Reinforcement Card -> adds 5 reinforcements for next phase.\n";
   player->setPendingReinforcements(5); // could be any number
-
-  if (deck) deck->addCard(new ReinforcementCard());
 }
 
 
@@ -104,12 +116,12 @@ BlockadeCard& BlockadeCard::operator=(const BlockadeCard& other) {
 BlockadeCard::~BlockadeCard() {}
 
 // --- GETTERS ---
-std::string BlockadeCard::getType() const {
-  return CARD_TYPES::BLOCKADE;
+CardType BlockadeCard::getType() const {
+  return CardType::BLOCKADE;
 }
 
 // --- UTILITY ---
-void BlockadeCard::play(Player* player, OrdersList* ordersList, Deck* deck) {
+void BlockadeCard::play(Player* player, OrdersList* ordersList) const {
   if (!player || !ordersList) return;
 
   std::cout << player->getName() << " plays Blockade Card -> create Blockade Order\n";
@@ -117,10 +129,8 @@ void BlockadeCard::play(Player* player, OrdersList* ordersList, Deck* deck) {
 
   if (target) {
     Player* neutralPlayer = GameEngine::getNeutralPlayer();
-    ordersList->addOrder(new OrderBlockade(neutralPlayer, player, target));
+    ordersList->addOrder(std::make_unique<OrderBlockade>(neutralPlayer, player, target));
   }
-
-  if (deck) deck->addCard(new BlockadeCard());
 }
 
 
@@ -136,28 +146,28 @@ AirliftCard& AirliftCard::operator=(const AirliftCard& other) {
 AirliftCard::~AirliftCard() {}
 
 // --- GETTERS ---
-std::string AirliftCard::getType() const {
-  return CARD_TYPES::AIRLIFT;
+CardType AirliftCard::getType() const {
+  return CardType::AIRLIFT;
 }
 
 // --- UTILITY ---
-void AirliftCard::play(Player* player, OrdersList* ordersList, Deck* deck) {
+void AirliftCard::play(Player* player, OrdersList* ordersList) const {
   if (!player || !ordersList) return;
 
   std::cout << player->getName() << " plays Airlift Card -> create Airlift Order\n";
   std::cout << "Choose source and target territories for airlift:\n";
 
-  Territory* source = chooseTerritory(player->toDefend());
-  Territory* target = chooseTerritory(player->toDefend());
+  // both picks share one memoized toDefend() result
+  const std::span<Territory* const> defendList = player->toDefend();
+  Territory* source = chooseTerritory(defendList);
+  Territory* target = chooseTerritory(defendList);
 
   if (source && target && source != target) {
     const int armies = source->getArmies() / 2;
     if (armies > 0) {
-      ordersList->addOrder(new OrderAirlift(player, source, target, new int(armies)));
+      ordersList->addOrder(std::make_unique<OrderAirlift>(player, source, target, armies));
     }
   }
-
-  if (deck) deck->addCard(new AirliftCard());
 }
 
 
@@ -173,144 +183,171 @@ DiplomacyCard& DiplomacyCard::operator=(const DiplomacyCard& other) {
 DiplomacyCard::~DiplomacyCard() {}
 
 // --- GETTERS ---
-std::string DiplomacyCard::getType() const {
-  return CARD_TYPES::DIPLOMACY;
+CardType DiplomacyCard::getType() const {
+  return CardType::DIPLOMACY;
 }
 
 // --- UTILITY ---
-void DiplomacyCard::play(Player* player, OrdersList* ordersList, Deck* deck) {
+void DiplomacyCard::play(Player* player, OrdersList* ordersList) const {
   if (!player || !ordersList) return;
   std::cout << player->getName() << " plays Diplomacy Card -> create Negotiate Order\n";
 
-  // choose another player
-  std::vector<Player*> otherPlayers;
-  GameEngine engine;
-  for (Player* p : engine.getPlayers()) {
-    if (p != player) otherPlayers.push_back(p);
+  // choose another player of the game playing on this thread
+  const std::span<const std::unique_ptr<Player>> roster = GameEngine::getRoster();
+  auto isOther = [player](const std::unique_ptr<Player>& p) { return p.get() != player; };
+  const std::ptrdiff_t others = std::ranges::count_if(roster, isOther);
+  if (others == 0) return;
+
+  Player* targetPlayer = nullptr;
+  if (GameEngine::getAutomaticMode()) {
+    // in automatic/tournament mode, pick one at random following the game's seed, without building a list
+    std::uniform_int_distribution<std::ptrdiff_t> dist(0, others - 1);
+    std::ptrdiff_t choice = dist(GameRandom::get());
+    for (const auto& p : roster) {
+      if (isOther(p) && choice-- == 0) {
+        targetPlayer = p.get();
+        break;
+      }
+    }
+    std::cout << "Auto-selected player: " << targetPlayer->getName() << "\n";
+  } else {
+    std::vector<Player*> otherPlayers;
+    for (const auto& p : roster) {
+      if (isOther(p)) otherPlayers.push_back(p.get());
+    }
+    targetPlayer = player->choosePlayer(otherPlayers);
   }
 
-  Player* targetPlayer = player->choosePlayer(otherPlayers);
-  if (targetPlayer) ordersList->addOrder(new OrderNegotiate(targetPlayer, player));
-  if (deck) deck->addCard(new DiplomacyCard());
+  if (targetPlayer) ordersList->addOrder(std::make_unique<OrderNegotiate>(targetPlayer, player));
 }
 
 
 // ==================== Deck Class Implementation ====================
-Deck::Deck() :
-  deckCards(new std::vector<Card*>()) {
+Deck::Deck() {
   // create multiple cards of each type
+  deckCards.reserve(3 * CARD_TYPE_COUNT);
   for (int i = 0; i < 3; i++) {
-    deckCards->push_back(new BombCard());
-    deckCards->push_back(new ReinforcementCard());
-    deckCards->push_back(new BlockadeCard());
-    deckCards->push_back(new AirliftCard());
-    deckCards->push_back(new DiplomacyCard());
+    deckCards.push_back(CardType::BOMB);
+    deckCards.push_back(CardType::REINFORCEMENT);
+    deckCards.push_back(CardType::BLOCKADE);
+    deckCards.push_back(CardType::AIRLIFT);
+    deckCards.push_back(CardType::DIPLOMACY);
   }
-  std::srand(static_cast<unsigned int>(std::time(nullptr)));
 }
 
-Deck::Deck(const Deck& other) {
-  copyCardsFrom(other.deckCards);
-}
+Deck::Deck(const Deck& other) = default;
 
-Deck& Deck::operator=(const Deck& other) {
-  if (this != &other) {
-    clearCards();
-    copyCardsFrom(other.deckCards);
-  }
-  return *this;
-}
+Deck::Deck(Deck&& other) noexcept = default;
+
+Deck& Deck::operator=(const Deck& other) = default;
+
+Deck& Deck::operator=(Deck&& other) noexcept = default;
+
+Deck::~Deck() = default;
 
-Deck::~Deck() {
-  clearCards();
+// --- GETTERS ---
+const std::vector<CardType>& Deck::getCards() const {
+  return deckCards;
 }
 
 // --- CARD MANAGEMENT ---
-void Deck::addCard(Card* card) {
-  if (card) deckCards->push_back(card);
+void Deck::addCard(CardType card) {
+  deckCards.push_back(card);
+}
+
+void Deck::removeAll() {
+  deckCards.clear();
 }
 
 // --- UTILITY ---
-Card* Deck::draw() {
-  if (deckCards->empty()) return nullptr;
+std::optional<CardType> Deck::draw(std::mt19937& rng) {
+  if (deckCards.empty()) return std::nullopt;
 
-  const int idx = rand() % deckCards->size();
-  Card* drawn = deckCards->at(idx);
+  // order within the deck carries no meaning, so fill the hole with the last card
+  std::uniform_int_distribution<std::size_t> pick(0, deckCards.size() - 1);
+  const std::size_t idx = pick(rng);
+  const CardType drawn = deckCards[idx];
 
-  deckCards->erase(deckCards->begin() + idx);
+  deckCards[idx] = deckCards.back();
+  deckCards.pop_back();
   return drawn;
 }
 
 void Deck::displayInfo() const {
-  std::cout << "Deck: (" << deckCards->size() << " cards)" << std::endl;
-  for (auto* crd : *deckCards) {
-    std::cout << "  - " << *crd << std::endl;
-  }
-}
-
-void Deck::clearCards() {
-  for (auto* crd : *deckCards) { delete crd; }
-  delete deckCards;
-}
-
-void Deck::copyCardsFrom(const std::vector<Card*>* sourceCards) {
-  deckCards = new std::vector<Card*>();
-  for (auto* crd : *sourceCards) {
-    deckCards->push_back(cloneCard(crd));
+  std::cout << "Deck: (" << deckCards.size() << " cards)" << std::endl;
+  for (const CardType crd : deckCards) {
+    std::cout << "  - " << Card::of(crd) << std::endl;
   }
 }
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const Deck& dec) {
-  os << "Deck[" << dec.deckCards->size() << " cards]";
+  os << "Deck[" << dec.deckCards.size() << " cards]";
   return os;
 }
 
 
 // ==================== Hand Class Implementation ====================
-Hand::Hand() :
- handCards(new std::vector<Card*>()) {}
+Hand::Hand() = default;
+
+Hand::Hand(const Hand& other) = default;
+
+Hand::Hand(Hand&& other) noexcept = default;
+
+Hand& Hand::operator=(const Hand& other) = default;
+
+Hand& Hand::operator=(Hand&& other) noexcept = default;
+
+Hand::~Hand() = default;
 
-Hand::Hand(const Hand& other) {
-  copyCardsFrom(other.handCards);
+// --- GETTERS ---
+int Hand::count(CardType type) const {
+  return counts[static_cast<int>(type)];
 }
 
-Hand& Hand::operator=(const Hand& other) {
-  if (this != &other) {
-    clearCards();
-    copyCardsFrom(other.handCards);
-  }
-  return *this;
+CardType Hand::cardAt(int index) const {
+  int type = 0;
+  while (index >= counts[type]) index -= counts[type++];
+  return static_cast<CardType>(type);
 }
 
-Hand::~Hand() {
-  clearCards();
+// --- CARD MANAGEMENT ---
+void Hand::addCard(CardType card) {
+  counts[static_cast<int>(card)]++;
+  total++;
 }
 
-// --- GETTERS ---
-const std::vector<Card*>* Hand::getCards() const {
-  return handCards;
+bool Hand::removeCard(CardType card) {
+  int& held = counts[static_cast<int>(card)];
+  if (held == 0) return false;
+
+  held--;
+  total--;
+  return true;
 }
 
-// --- CARD MANAGEMENT ---
-void Hand::addCard(Card* card) {
-  if (card) handCards->push_back(card);
+void Hand::removeAll() {
+  counts.fill(0);
+  total = 0;
 }
 
 void Hand::playCard(int index, Player* player, OrdersList* ordersList, Deck* deck) {
-  if (index >= 0 && index < handCards->size()) {
-    Card* card = handCards->at(index);
-    card->play(player, ordersList, deck);
-
-    // remove from hand (card is returned to deck in play() method)
-    handCards->erase(handCards->begin() + index);
-    delete card; // delete original card instance
+  if (index >= 0 && index < total) {
+    playCard(cardAt(index), player, ordersList, deck);
   }
 }
 
+void Hand::playCard(CardType card, Player* player, OrdersList* ordersList, Deck* deck) {
+  // take the card out of the hand first, so playing it sees the hand without it
+  if (!removeCard(card)) return;
+
+  Card::of(card).play(player, ordersList);
+  if (deck) deck->addCard(card);
+}
+
 void Hand::playAll(Player* player, OrdersList* ordersList, Deck* deck) {
   std::cout << "Playing all cards in hand..." << std::endl;
-  while (!handCards->empty()) {
+  while (total > 0) {
     playCard(0, player, ordersList, deck);
   }
   std::cout << "All cards have been played and returned to deck." << std::endl;
@@ -318,64 +355,50 @@ void Hand::playAll(Player* player, OrdersList* ordersList, Deck* deck) {
 
 // --- UTILITY ---
 int Hand::size() const {
-  return handCards->size();
+  return total;
 }
 
 void Hand::displayInfo() const {
-  std::cout << "Hand: (" << handCards->size() << " cards)" << std::endl;
-  for (auto* crd : *handCards) {
-    std::cout << "  - " << *crd << std::endl;
+  std::cout << "Hand: (" << total << " cards)" << std::endl;
+  for (int i = 0; i < total; i++) {
+    std::cout << "  - " << Card::of(cardAt(i)) << std::endl;
   }
 }
 
 bool Hand::empty() const {
-  return !handCards || handCards->empty();
-}
-
-void Hand::clearCards() {
-  for (auto* crd : *handCards) { delete crd; }
-  delete handCards;
-}
-
-void Hand::copyCardsFrom(const std::vector<Card*>* sourceCards) {
-  handCards = new std::vector<Card*>();
-  for (auto* c : *sourceCards) {
-    handCards->push_back(cloneCard(c));
-  }
+  return total == 0;
 }
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const Hand& hnd) {
-  os << "Hand[" << hnd.handCards->size() << " cards]";
+  os << "Hand[" << hnd.total << " cards]";
   return os;
 }
 
 
 // ==================== Class Helpers Implementation ====================
-Card* cloneCard(const Card* card) {
-  if (!card) return nullptr;
-  const std::string type = card->getType();
-
-  if (type == CARD_TYPES::BOMB) return new BombCard();
-  if (type == CARD_TYPES::REINFORCEMENT) return new ReinforcementCard();
-  if (type == CARD_TYPES::BLOCKADE) return new BlockadeCard();
-  if (type == CARD_TYPES::AIRLIFT) return new AirliftCard();
-  if (type == CARD_TYPES::DIPLOMACY) return new DiplomacyCard();
-  return nullptr;
+const char* cardTypeName(CardType type) {
+  switch (type) {
+    case CardType::BOMB: return CARD_TYPES::BOMB;
+    case CardType::REINFORCEMENT: return CARD_TYPES::REINFORCEMENT;
+    case CardType::BLOCKADE: return CARD_TYPES::BLOCKADE;
+    case CardType::AIRLIFT: return CARD_TYPES::AIRLIFT;
+    case CardType::DIPLOMACY: return CARD_TYPES::DIPLOMACY;
+  }
+  return "unknown";
 }
 
 
 // ==================== Class Utility Implementation ====================
-Territory* chooseTerritory(const std::vector<Territory*>& territories) {
+Territory* chooseTerritory(std::span<Territory* const> territories) {
   if (territories.empty()) return nullptr;
 
   // in automatic/tournament mode, automatically select a territory
   if (GameEngine::getAutomaticMode()) {
-    // randomly select a territory for variety
-    static std::mt19937 rng(std::random_device{}());
+    // randomly select a territory for variety, following the game's seed
     std::uniform_int_distribution<size_t> dist(0, territories.size() - 1);
 
-    const size_t choice = dist(rng);
+    const size_t choice = dist(GameRandom::get());
     std::cout << "Auto-selected territory: " << territories[choice]->getName() << "\n";
     return territories[choice];
   }
@@ -389,7 +412,7 @@ Territory* chooseTerritory(const std::vector<Territory*>& territories) {
   int choice = -1;
   while (choice < 0 || choice >= territories.size()) {
     std::cout << "Enter the number of your choice: ";
-    std::cin >> choice;
+    choice = Input::readInt();
   }
 
   return territories[choice];
@@ -1,5 +1,10 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <iostream>
+#include <optional>
+#include <random>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -9,7 +14,16 @@ class OrdersList;
 class Deck;
 
 /**
- * Abstract base class for all card types.
+ * A card is just its type; decks and hands store these values directly.
+ */
+enum class CardType : std::uint8_t { BOMB, REINFORCEMENT, BLOCKADE, AIRLIFT, DIPLOMACY };
+
+constexpr int CARD_TYPE_COUNT = 5;
+
+
+/**
+ * Abstract base class for all card behaviours.
+ * Behaviours are stateless, so one shared instance per type serves every card of that type.
  */
 class Card {
 public:
@@ -18,10 +32,11 @@ public:
   virtual ~Card(); // destructor
 
   // getters
-  virtual std::string getType() const = 0;
+  virtual CardType getType() const = 0;
+  static const Card& of(CardType type); // shared behaviour for a card type
 
   // utility
-  virtual void play(Player* player, OrdersList* ordersList, Deck* deck) = 0;
+  virtual void play(Player* player, OrdersList* ordersList) const = 0; // the hand returns the card to the deck
 
   // stream insertion operator
   friend std::ostream& operator<<(std::ostream& os, const Card& crd);
@@ -39,10 +54,10 @@ public:
   ~BombCard() override; // destructor
 
   // getters
-  std::string getType() const override;
+  CardType getType() const override;
 
   // utility
-  void play(Player* player, OrdersList* ordersList, Deck* deck) override;
+  void play(Player* player, OrdersList* ordersList) const override;
 };
 
 
@@ -54,10 +69,10 @@ public:
   ~ReinforcementCard() override; // destructor
 
   // getters
-  std::string getType() const override;
+  CardType getType() const override;
 
   // utility
-  void play(Player* player, OrdersList* ordersList, Deck* deck) override;
+  void play(Player* player, OrdersList* ordersList) const override;
 };
 
 
@@ -69,10 +84,10 @@ public:
   ~BlockadeCard() override; // destructor
 
   // getters
-  std::string getType() const override;
+  CardType getType() const override;
 
   // utility
-  void play(Player* player, OrdersList* ordersList, Deck* deck) override;
+  void play(Player* player, OrdersList* ordersList) const override;
 };
 
 
@@ -84,10 +99,10 @@ public:
   ~AirliftCard() override; // destructor
 
   // getters
-  std::string getType() const override;
+  CardType getType() const override;
 
   // utility
-  void play(Player* player, OrdersList* ordersList, Deck* deck) override;
+  void play(Player* player, OrdersList* ordersList) const override;
 };
 
 
@@ -99,59 +114,71 @@ public:
   ~DiplomacyCard() override; // destructor
 
   // getters
-  std::string getType() const override;
+  CardType getType() const override;
 
   // utility
-  void play(Player* player, OrdersList* ordersList, Deck* deck) override;
+  void play(Player* player, OrdersList* ordersList) const override;
 };
 
 
+/**
+ * Unordered pile of cards. Drawing takes a random card and swaps the last one into its slot.
+ */
 class Deck {
 private:
-  std::vector<Card*>* deckCards;
+  std::vector<CardType> deckCards;
 
 public:
   Deck();
   Deck(const Deck& other); // copy constructor
+  Deck(Deck&& other) noexcept; // move constructor
   Deck& operator=(const Deck& other); // assignment operator
+  Deck& operator=(Deck&& other) noexcept; // move assignment operator
   ~Deck(); // destructor
 
+  // getters
+  const std::vector<CardType>& getCards() const;
+
   // card management
-  void addCard(Card* card);
+  void addCard(CardType card);
+  void removeAll();
 
   // utility
-  Card* draw();
+  std::optional<CardType> draw(std::mt19937& rng); // empty when the deck has run out
   void displayInfo() const;
 
   // stream insertion operator
   friend std::ostream& operator<<(std::ostream& os, const Deck& dec);
-
-private:
-  // utility
-  void clearCards();
-  void copyCardsFrom(const std::vector<Card*>* sourceCards);
 };
 
 
 /**
- * Represents a player's hand of cards.
+ * Represents a player's hand of cards, kept as a count per card type.
+ * Card indices run through the types in declaration order.
  */
 class Hand {
 private:
-  std::vector<Card*>* handCards;
+  std::array<int, CARD_TYPE_COUNT> counts{};
+  int total = 0;
 
 public:
   Hand();
   Hand(const Hand& other); // copy constructor
+  Hand(Hand&& other) noexcept; // move constructor
   Hand& operator=(const Hand& other); // assignment operator
+  Hand& operator=(Hand&& other) noexcept; // move assignment operator
   ~Hand(); // destructor
 
   // getters
-  const std::vector<Card*>* getCards() const;
+  int count(CardType type) const;
+  CardType cardAt(int index) const; // index must be in [0, size())
 
   // card management
-  void addCard(Card* card);
+  void addCard(CardType card);
+  bool removeCard(CardType card);
+  void removeAll();
   void playCard(int index, Player* player, OrdersList* ordersList, Deck* deck);
+  void playCard(CardType card, Player* player, OrdersList* ordersList, Deck* deck); // puts the card back into the deck
   void playAll(Player* player, OrdersList* ordersList, Deck* deck);
 
   // utility
@@ -161,11 +188,6 @@ public:
 
   // stream insertion operator
   friend std::ostream& operator<<(std::ostream& os, const Hand& hnd);
-
-private:
-  // utility
-  void clearCards();
-  void copyCardsFrom(const std::vector<Card*>* sourceCards);
 };
 
 // namespaces
@@ -181,7 +203,7 @@ namespace CARD_TYPES {
 void testCards();
 
 // helpers
-Card* cloneCard(const Card* card);
+const char* cardTypeName(CardType type);
 
 // utility
-Territory* chooseTerritory(const std::vector<Territory*>& territories);
\ No newline at end of file
+Territory* chooseTerritory(std::span<Territory* const> territories);
\ No newline at end of file
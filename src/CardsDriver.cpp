@@ -1,6 +1,7 @@
 #include "Cards.h"
 #include "Orders.h"
 #include "Player.h"
+#include "Utility.h"
 
 void testCards() {
   std::cout << "\n=== Testing Cards Deck/Hand ===" << std::endl;
@@ -19,10 +20,9 @@ void testCards() {
   // draw 5 cards from deck by repeatedly calling draw() method
   std::cout << "\nDrawing 5 cards..." << std::endl;
   for (int i = 0; i < 5; i++) {
-    Card* drawnCard = deck.draw();
-    if (drawnCard) {
-      hand.addCard(drawnCard);
-      std::cout << " Drew: " << *drawnCard << std::endl;
+    if (const auto drawnCard = deck.draw(GameRandom::get())) {
+      std::cout << " Drew: " << Card::of(*drawnCard) << std::endl;
+      hand.addCard(*drawnCard);
     }
   }
 
@@ -39,7 +39,7 @@ void testCards() {
 
   // store initial deck size to verify cards are returned
   int initialDeckSize = 0;
-  while (tempDeck.draw() != nullptr) initialDeckSize++;
+  while (tempDeck.draw(GameRandom::get())) initialDeckSize++;
 
   (void) initialDeckSize;
   hand.playAll(dummyPlayer, dummyOrders, &deck);
@@ -53,10 +53,9 @@ void testCards() {
 
   // test individual card playing
   std::cout << "\n5. Testing individual card play:" << std::endl;
-  Card* testCard = deck.draw();
-  if (testCard) {
-    hand.addCard(testCard);
-    std::cout << "Added card to hand: " << *testCard << std::endl;
+  if (const auto testCard = deck.draw(GameRandom::get())) {
+    std::cout << "Added card to hand: " << Card::of(*testCard) << std::endl;
+    hand.addCard(*testCard);
     hand.displayInfo();
 
     // play the single card
@@ -70,8 +69,7 @@ void testCards() {
   // add cards to hand before testing copy
   std::cout << "Drawing 3 cards for copy testing..." << std::endl;
   for (int i = 0; i < 3; i++) {
-    Card* card = deck.draw();
-    if (card) hand.addCard(card);
+    if (const auto card = deck.draw(GameRandom::get())) hand.addCard(*card);
   }
 
   std::cout << "Original hand before copying: " << hand << std::endl;
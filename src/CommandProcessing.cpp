@@ -1,9 +1,23 @@
 #include "CommandProcessing.h"
 #include "GameEngine.h"
-
+#include "Input.h"
+#include "TournamentExport.h"
+#include "TournamentSpec.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <string_view>
+#include <thread>
 #include <vector>
 
+namespace fs = std::filesystem;
+
 
 // ==================== Command Class Implementation ====================
 Command::Command() :
@@ -69,45 +83,63 @@ std::ostream& operator<<(std::ostream& os, const Command& cmd) {
 
 
 // ==================== CommandProcessor Class Implementation ====================
+namespace {
+  CommandRecord recordOf(const Command& cmd) {
+    const std::string text = cmd.getCommand();
+    const std::size_t space = text.find(' ');
+
+    CommandRecord record{GameStateMachine::parseCommand(std::string_view(text).substr(0, space)), "", cmd.getEffect()};
+    if (!record.command) record.argument = text;
+    else if (space != std::string::npos) record.argument = text.substr(space);
+    return record;
+  }
+
+  std::string textOf(const CommandRecord& record) {
+    if (!record.command) return record.argument;
+    return std::string(GameStateMachine::nameOf(*record.command)) + record.argument;
+  }
+
+  Command commandOf(const CommandRecord& record) {
+    Command cmd(textOf(record));
+    cmd.saveEffect(record.effect);
+    return cmd;
+  }
+
+  // one journal line per command: the command text, a tab, then its effect
+  std::string encodeCommand(const CommandRecord& record) {
+    return textOf(record) + "\t" + record.effect;
+  }
+
+  Command decodeCommand(const std::string& line) {
+    const std::size_t tab = line.rfind('\t');
+    Command cmd(line.substr(0, tab));
+    if (tab != std::string::npos) cmd.saveEffect(line.substr(tab + 1));
+    return cmd;
+  }
+}
+
 CommandProcessor::CommandProcessor() :
   Subject(),
-  commands(new std::vector<Command*>()),
-  lastSavedCommand(nullptr) {}
+  commands(HISTORY_CAPACITY, encodeCommand) {}
 
 CommandProcessor::CommandProcessor(const CommandProcessor& other) :
   Subject(other),
-  commands(new std::vector<Command*>()),
-  lastSavedCommand(nullptr) {
-  // deep copy commands
-  for (const Command* cmd : *other.commands) {
-    commands->push_back(new Command(*cmd));
-  }
-  if (!commands->empty()) lastSavedCommand = commands->back();
-}
+  commands(other.commands), // the records still in memory
+  current(other.current ? std::make_unique<Command>(*other.current) : nullptr) {}
 
 CommandProcessor& CommandProcessor::operator=(const CommandProcessor& other) {
   if (this != &other) {
     Subject::operator=(other);
-    // delete old objects
-    for (const Command* cmd : *commands) { delete cmd; }
-    commands->clear();
+    commands.clear();
 
-    // deep copy commands
-    for (const Command* cmd : *other.commands) {
-      commands->push_back(new Command(*cmd));
-    }
-    lastSavedCommand = commands->empty() ? nullptr : commands->back();
+    // copy the records still in memory; this processor keeps its own journal, which clear leaves intact
+    other.commands.forEach([this](const CommandRecord& record) { commands.push(record); });
+    current = other.current ? std::make_unique<Command>(*other.current) : nullptr;
   }
   return *this;
 }
 
-CommandProcessor::~CommandProcessor() {
-  for (const Command* cmd : *commands) { delete cmd; }
-  delete commands;
-
-  commands = nullptr;
-  lastSavedCommand = nullptr;
-}
+CommandProcessor::~CommandProcessor() = default;
 
 // --- GETTERS ---
 Command* CommandProcessor::getCommand() {
@@ -118,25 +150,39 @@ Command* CommandProcessor::getCommand() {
   return cmd;
 }
 
-std::vector<Command*> CommandProcessor::getCommands() const {
-  return *commands;
+std::vector<Command> CommandProcessor::getCommands() const {
+  std::vector<Command> all;
+  for (const std::string& line : commands.readJournal()) all.push_back(decodeCommand(line));
+
+  commands.forEach([&all](const CommandRecord& record) { all.push_back(commandOf(record)); });
+  if (current) all.push_back(*current);
+  return all;
+}
+
+// --- SETTERS ---
+bool CommandProcessor::setJournal(const std::string& path) {
+  return commands.setJournal(path);
 }
 
 // --- UTILITY ---
 std::string CommandProcessor::readCommand() const {
-  std::string cmdStr;
   std::cout << "Enter command: ";
-  std::getline(std::cin, cmdStr);
-  return cmdStr;
+  return Input::readLine();
+}
+
+bool CommandProcessor::hasMoreCommands() const {
+  InputQueue& input = Input::queue();
+  return !input.isClosed() || input.size() > 0;
 }
 
 void CommandProcessor::saveCommand(Command* cmd) {
-  commands->push_back(cmd);
-  lastSavedCommand = cmd;
+  // the previous command is done with: only its text and effect are kept
+  if (current) commands.push(recordOf(*current));
+  current.reset(cmd);
 
   // propagate observers to newly saved command
   if (cmd) {
-    for (Observer* observer : *observers) {
+    for (Observer* observer : observers) {
       cmd->attach(observer);
     }
   }
@@ -147,8 +193,7 @@ void CommandProcessor::saveCommand(Command* cmd) {
 bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine) const {
   if (cmd.empty() || engine == nullptr) return false;
 
-  // get the current state name
-  std::string currState = engine->getCurrentStateName();
+  const GameState currState = engine->getCurrentState();
 
   // parse the base command
   std::string baseCmd = cmd;
@@ -158,11 +203,26 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
   }
 
   if (baseCmd == "tournament") {
-    if (currState != "start") {
+    if (currState != GameState::START) {
       std::cout << "Tournament command can only be used in 'start' state.\n";
       return false;
     }
 
+    // a spec file replaces every other flag
+    const std::size_t fPos = cmd.find("-F ");
+    if (fPos != std::string::npos) {
+      std::string specFile = cmd.substr(fPos + 3);
+      specFile.erase(0, specFile.find_first_not_of(" \t\n\r"));
+      specFile.erase(specFile.find_last_not_of(" \t\n\r") + 1);
+
+      std::string error;
+      if (specFile.empty() || !TournamentSpec::load(specFile, error)) {
+        std::cout << "Invalid tournament spec " << specFile << ": " << (specFile.empty() ? "no file given" : error) << "\n";
+        return false;
+      }
+      return true;
+    }
+
     std::size_t mPos = cmd.find("-M ");
     std::size_t pPos = cmd.find("-P ");
     std::size_t gPos = cmd.find("-G ");
@@ -171,7 +231,8 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
     if (mPos == std::string::npos || pPos == std::string::npos ||
       gPos == std::string::npos || dPos == std::string::npos) {
       std::cout << "Incorrect format. Must follow: tournament -M <listofmapfiles> -P "
-                   "<listofplayerstrategies> -G <numberofgames> -D <maxnumberofturns>\n";
+                   "<listofplayerstrategies> -G <numberofgames> -D <maxnumberofturns> [-C <checkpointfile>] [-O <exportfiles>] [-T <tracefile>]"
+                   " or tournament -F <specfile>\n";
       return false;
     }
 
@@ -185,7 +246,21 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
     std::string mapsStr = cmd.substr(mPos + 3, pPos - mPos - 3);
     std::string playersStr = cmd.substr(pPos + 3, gPos - pPos - 3);
     std::string gamesStr = cmd.substr(gPos + 3, dPos - gPos - 3);
-    std::string turnsStr = cmd.substr(dPos + 3);
+    // optional flags follow -D in any order: -C <checkpoint file>, -O <export files>, -T <trace file>
+    auto nextOption = [&cmd](std::size_t from) {
+      return std::min({cmd.find("-C ", from), cmd.find("-O ", from), cmd.find("-T ", from)});
+    };
+    auto optionValue = [&cmd, dPos, &nextOption](const char* flag) -> std::string {
+      const std::size_t pos = cmd.find(flag, dPos);
+      if (pos == std::string::npos) return "";
+      const std::size_t end = nextOption(pos + 3);
+      return cmd.substr(pos + 3, end == std::string::npos ? std::string::npos : end - pos - 3);
+    };
+    const std::size_t optPos = nextOption(dPos);
+    std::string turnsStr = cmd.substr(dPos + 3, optPos == std::string::npos ? std::string::npos : optPos - dPos - 3);
+    std::string checkpointStr = optionValue("-C ");
+    std::string outputStr = optionValue("-O ");
+    std::string traceStr = optionValue("-T ");
 
     // helper lambda to trim whitespace
     auto trim = [](std::string& s) {
@@ -205,7 +280,7 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
     trim(gamesStr);
     trim(turnsStr);
 
-    // validate maps: count comma-separated items (1-5 maps)
+    // validate maps: count comma-separated items (at least 1 map)
     if (mapsStr.empty()) {
       std::cout << "No map files specified.\n";
       return false;
@@ -214,12 +289,12 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
     for (char c : mapsStr) {
       if (c == ',') mapCount++;
     }
-    if (mapCount < 1 || mapCount > 5) {
-      std::cout << "Invalid number of maps. Must be between 1 and 5.\n";
+    if (mapCount < 1) {
+      std::cout << "Invalid number of maps. Must be at least 1.\n";
       return false;
     }
 
-    // validate players: count comma-separated items (2-4 strategies)
+    // validate players: count comma-separated items (at least 2 strategies)
     if (playersStr.empty()) {
       std::cout << "No player strategies specified.\n";
       return false;
@@ -228,12 +303,12 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
     for (char c : playersStr) {
       if (c == ',') playerCount++;
     }
-    if (playerCount < 2 || playerCount > 4) {
-      std::cout << "Invalid number of player strategies. Must be between 2 and 4.\n";
+    if (playerCount < 2) {
+      std::cout << "Invalid number of player strategies. Must be at least 2.\n";
       return false;
     }
 
-    // validate number of games (1-5)
+    // validate number of games (at least 1)
     if (gamesStr.empty()) {
       std::cout << "No number of games specified.\n";
       return false;
@@ -245,12 +320,12 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
       std::cout << "Invalid number of games. Must be an integer.\n";
       return false;
     }
-    if (numGames < 1 || numGames > 5) {
-      std::cout << "Invalid number of games. Must be between 1 and 5.\n";
+    if (numGames < 1) {
+      std::cout << "Invalid number of games. Must be at least 1.\n";
       return false;
     }
 
-    // validate max turns (10-50)
+    // validate max turns (at least 1)
     if (turnsStr.empty()) {
       std::cout << "No max number of turns specified.\n";
       return false;
@@ -262,8 +337,38 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
       std::cout << "Invalid max number of turns. Must be an integer.\n";
       return false;
     }
-    if (maxTurns < 10 || maxTurns > 50) {
-      std::cout << "Invalid max number of turns. Must be between 10 and 50.\n";
+    if (maxTurns < 1) {
+      std::cout << "Invalid max number of turns. Must be at least 1.\n";
+      return false;
+    }
+
+    // validate checkpoint file (optional)
+    trim(checkpointStr);
+    if (cmd.find("-C ", dPos) != std::string::npos && checkpointStr.empty()) {
+      std::cout << "No checkpoint file specified after -C.\n";
+      return false;
+    }
+
+    // validate export files (optional): .csv, .jsonl or .col
+    trim(outputStr);
+    if (cmd.find("-O ", dPos) != std::string::npos && outputStr.empty()) {
+      std::cout << "No export file specified after -O.\n";
+      return false;
+    }
+    std::istringstream outputStream(outputStr);
+    std::string outputFile;
+    while (std::getline(outputStream, outputFile, ',')) {
+      trim(outputFile);
+      if (!outputFile.empty() && !TournamentExporter::isSupportedFile(outputFile)) {
+        std::cout << "Unsupported export file " << outputFile << ". Use .csv, .jsonl or .col.\n";
+        return false;
+      }
+    }
+
+    // validate trace file (optional)
+    trim(traceStr);
+    if (cmd.find("-T ", dPos) != std::string::npos && traceStr.empty()) {
+      std::cout << "No trace file specified after -T.\n";
       return false;
     }
 
@@ -271,32 +376,31 @@ bool CommandProcessor::validate(const std::string& cmd, const GameEngine* engine
     return true;
   }
 
-  // validate based on current state according to assignment state diagram
-  if (currState == GAME_PHASES::STARTUP && baseCmd == GAME_STATES::START) return true;
-  if (currState == GAME_STATES::START && baseCmd == GAME_TRANSITIONS::LOADMAP) return true;
-  if (currState == GAME_STATES::MAP_LOADED && (baseCmd == GAME_TRANSITIONS::LOADMAP || baseCmd == GAME_TRANSITIONS::VALIDATEMAP)) return true;
-  if (currState == GAME_STATES::MAP_VALIDATED && baseCmd == GAME_TRANSITIONS::ADDPLAYER) return true;
-  if (currState == GAME_STATES::PLAYERS_ADDED && (baseCmd == GAME_TRANSITIONS::ADDPLAYER || baseCmd == "gamestart")) return true;
-  if (currState == GAME_STATES::ASSIGN_REINFORCEMENT && baseCmd == GAME_TRANSITIONS::ISSUEORDER) return true;
-  if (currState == GAME_STATES::ISSUE_ORDERS && (baseCmd == GAME_TRANSITIONS::ISSUEORDER || baseCmd == GAME_TRANSITIONS::ENDISSUEORDERS)) return true;
-  if (currState == GAME_STATES::EXECUTE_ORDERS && (baseCmd == GAME_TRANSITIONS::EXECORDER || baseCmd == GAME_TRANSITIONS::ENDEXECORDERS || baseCmd == GAME_STATES::WIN)) return true;
-  if (currState == GAME_STATES::WIN && (baseCmd == GAME_TRANSITIONS::REPLAY || baseCmd == GAME_TRANSITIONS::QUIT)) return true;
+  // validate based on current state according to the engine's state diagram
+  const std::optional<GameCommand> command = GameStateMachine::parseCommand(baseCmd);
+  if (command && GameStateMachine::next(currState, *command)) return true;
   if (baseCmd == "help") return true;
 
+  // saving and loading are allowed from any state
+  if (baseCmd == GAME_TRANSITIONS::SAVEGAME || baseCmd == GAME_TRANSITIONS::LOADGAME) return true;
+
   return false;
 }
 
 std::string CommandProcessor::stringToLog() const {
-  if (lastSavedCommand) return "CommandProcessor saved: " + lastSavedCommand->getCommand();
+  if (current) return "CommandProcessor saved: " + current->getCommand();
   return "CommandProcessor has no commands saved.";
 }
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const CommandProcessor& cp) {
-  os << "CommandProcessor[" << cp.commands->size() << " commands:\n";
-  for (size_t i = 0; i < cp.commands->size(); i++) {
-    os << " " << (i + 1) << ". " << *(*cp.commands)[i] << "\n";
-  }
+  // numbering carries on from the commands already pushed out of memory
+  os << "CommandProcessor[" << cp.commands.getEvicted() + cp.commands.size() + (cp.current ? 1 : 0) << " commands:\n";
+  std::size_t number = cp.commands.getEvicted();
+  cp.commands.forEach([&os, &number](const CommandRecord& record) {
+    os << " " << ++number << ". " << commandOf(record) << "\n";
+  });
+  if (cp.current) os << " " << ++number << ". " << *cp.current << "\n";
   os << "]";
   return os;
 }
@@ -397,6 +501,10 @@ FileCommandProcessorAdapter::~FileCommandProcessorAdapter() {
 }
 
 // --- UTILITY ---
+bool FileCommandProcessorAdapter::hasMoreCommands() const {
+  return fileReader && fileReader->hasMoreLines();
+}
+
 std::string FileCommandProcessorAdapter::readCommand() const {
   std::string line = fileReader->readLineFromFile();
   if (!line.empty()) {
@@ -415,4 +523,135 @@ std::ostream& operator<<(std::ostream& os, const FileCommandProcessorAdapter& fc
   }
   os << "]";
   return os;
-}
\ No newline at end of file
+}
+
+
+// ==================== CommandScriptBatch Class Implementation ====================
+namespace {
+  bool readWhole(const std::string& path, std::string& text) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    std::ostringstream buffer;
+    buffer << in.rdbuf();
+    text = std::move(buffer).str();
+    return true;
+  }
+}
+
+CommandScriptBatch::CommandScriptBatch(std::vector<std::string> scripts) :
+  scripts(std::move(scripts)) {}
+
+// --- GETTERS ---
+const std::vector<std::string>& CommandScriptBatch::getScripts() const {
+  return scripts;
+}
+
+// --- MANAGEMENT ---
+std::vector<ScriptResult> CommandScriptBatch::run(int workers) const {
+  std::vector<ScriptResult> results(scripts.size());
+  if (scripts.empty()) return results;
+
+  const int threadCount = std::min(
+    workers > 0 ? workers : Parallelism::available(),
+    static_cast<int>(scripts.size())
+  );
+
+  // workers pull the next script index until none are left; each writes only its own result slot
+  std::atomic<std::size_t> next{0};
+  auto work = [this, &results, &next] {
+    const Parallelism::PoolScope pooled;
+    const Console::MuteScope quiet;
+    for (std::size_t i = next++; i < scripts.size(); i = next++) results[i] = runScript(scripts[i]);
+  };
+
+  const Console::FilterScope filtered;
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threadCount; t++) pool.emplace_back(work);
+  for (auto& worker : pool) worker.join();
+  return results;
+}
+
+ScriptResult CommandScriptBatch::runScript(const std::string& path) {
+  const auto start = std::chrono::steady_clock::now();
+  ScriptResult result;
+  result.path = path;
+
+  std::string text;
+  result.readable = readWhole(path, text);
+
+  GameEngine engine;
+  const CommandProcessor processor;
+
+  // same stopping rule as the file adapter: the script ends at the first empty line or 'quit'
+  std::string_view rest = text;
+  while (result.readable && !rest.empty()) {
+    const std::size_t eol = rest.find('\n');
+    std::string_view line = rest.substr(0, eol);
+    rest = eol == std::string_view::npos ? std::string_view() : rest.substr(eol + 1);
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    if (line.empty() || line == GAME_TRANSITIONS::QUIT) break;
+
+    const std::string cmd(line);
+    result.commands++;
+    if (processor.validate(cmd, &engine)) {
+      engine.processCommand(cmd);
+      result.accepted++;
+    } else {
+      result.rejected++;
+    }
+  }
+
+  result.finalState = engine.getCurrentStateName();
+  result.wallTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+// --- UTILITY ---
+std::vector<std::string> CommandScriptBatch::collect(const std::string& source) {
+  std::vector<std::string> found;
+  std::error_code ec;
+
+  if (fs::is_directory(source, ec)) {
+    for (const auto& entry : fs::directory_iterator(source, ec)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".txt") found.push_back(entry.path().string());
+    }
+    std::ranges::sort(found);
+    return found;
+  }
+
+  // a manifest lists one script per line, relative paths are taken from the manifest's folder
+  std::ifstream manifest(source);
+  const fs::path base = fs::path(source).parent_path();
+  for (std::string line; std::getline(manifest, line);) {
+    line.erase(0, line.find_first_not_of(" \t"));
+    line.erase(line.find_last_not_of(" \t\r") + 1);
+    if (line.empty() || line.front() == '#') continue;
+
+    const fs::path script(line);
+    found.push_back(script.is_absolute() ? script.string() : (base / script).string());
+  }
+  return found;
+}
+
+void CommandScriptBatch::report(std::span<const ScriptResult> results, std::ostream& os) {
+  int unreadable = 0, withRejects = 0, commands = 0;
+  double totalMs = 0.0;
+
+  for (const ScriptResult& res : results) {
+    const char* outcome = !res.readable ? "UNREADABLE" : res.rejected > 0 ? "REJECTS" : "OK";
+    os << std::left << std::setw(11) << outcome << res.path
+       << "  commands=" << res.commands << " accepted=" << res.accepted << " rejected=" << res.rejected
+       << " final='" << res.finalState << "' " << std::fixed << std::setprecision(3) << res.wallTimeMs << " ms\n";
+
+    unreadable += !res.readable;
+    withRejects += res.readable && res.rejected > 0;
+    commands += res.commands;
+    totalMs += res.wallTimeMs;
+  }
+
+  os << results.size() << " scripts, " << commands << " commands, " << withRejects << " with rejected commands, "
+     << unreadable << " unreadable, " << std::fixed << std::setprecision(3) << totalMs << " ms script time\n";
+  os.unsetf(std::ios::floatfield);
+}
+
@@ -1,11 +1,18 @@
 #pragma once
+#include "History.h"
 #include "LoggingObserver.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 class GameEngine;
+enum class GameCommand : std::uint8_t;
 
 /**
  * The Command class represents a game command with its associated effect.
@@ -36,15 +43,30 @@ public:
 };
 
 
+/**
+ * Compact form of a command once a newer one has been read: the state diagram command it starts with, the rest
+ * of its line and the effect it was given. Lines that start with any other word (tournament, savegame, help,
+ * typos) keep their whole text as the argument.
+ */
+struct CommandRecord {
+  std::optional<GameCommand> command;
+  std::string argument; // rest of the line, separator included, so the text comes back exactly
+  std::string effect;
+};
+
+
 /**
  * The CommandProcessor class handles reading and storing commands.
  * The commands can be read from the console or overridden by subclasses.
  * Game components must get their commands from this processor.
  */
 class CommandProcessor : public Subject, public ILoggable {
+public:
+  static constexpr std::size_t HISTORY_CAPACITY = 128; // commands kept in memory, older ones go to the journal
+
 private:
-  std::vector<Command*>* commands; // a collection of command objects
-  Command* lastSavedCommand;
+  BoundedHistory<CommandRecord> commands; // the commands saved before the current one
+  std::unique_ptr<Command> current;       // the last command saved, still open for its effect and observers
 
 public:
   CommandProcessor();
@@ -53,12 +75,16 @@ public:
   virtual ~CommandProcessor(); // destructor
 
   // getters
-  Command* getCommand();
-  std::vector<Command*> getCommands() const;
+  Command* getCommand(); // owned by the processor, valid until the next command is saved
+  std::vector<Command> getCommands() const; // journaled commands first, then the ones still in memory
+
+  // setters
+  bool setJournal(const std::string& path); // evicted commands are appended here, empty path drops them
 
   // utility
-  void saveCommand(Command* cmd);
+  void saveCommand(Command* cmd); // takes ownership; the previous command is compacted into the history
   bool validate(const std::string& cmd, const GameEngine* engine) const;
+  virtual bool hasMoreCommands() const; // false once the source is closed and every command has been read
   std::string stringToLog() const override;
 
   // stream insertion
@@ -108,6 +134,9 @@ public:
   FileCommandProcessorAdapter& operator=(const FileCommandProcessorAdapter& other); // assignment operator
   ~FileCommandProcessorAdapter() override; // destructor
 
+  // utility
+  bool hasMoreCommands() const override;
+
   // stream insertion
   friend std::ostream& operator<<(std::ostream& os, const FileCommandProcessorAdapter& fcpa);
 
@@ -116,5 +145,45 @@ private:
   std::string readCommand() const override;
 };
 
+
+/**
+ * Outcome of running one command script through its own engine.
+ */
+struct ScriptResult {
+  std::string path;
+  bool readable = false;
+  int commands = 0;       // commands run before the script ended
+  int accepted = 0;
+  int rejected = 0;       // invalid in the engine's state at the time
+  std::string finalState;
+  double wallTimeMs = 0.0;
+};
+
+
+/**
+ * The CommandScriptBatch class runs many command scripts, each in an isolated engine, across a pool of threads.
+ * Every script is read in one go and its lines are validated and processed exactly as the file adapter would
+ * feed them, stopping at the first empty line or 'quit'. Engine output on the batch's threads is muted.
+ */
+class CommandScriptBatch {
+private:
+  std::vector<std::string> scripts;
+
+public:
+  explicit CommandScriptBatch(std::vector<std::string> scripts);
+
+  // getters
+  const std::vector<std::string>& getScripts() const;
+
+  // management
+  std::vector<ScriptResult> run(int workers = 0) const; // 0 uses every hardware thread
+  static ScriptResult runScript(const std::string& path);
+
+  // utility
+  static std::vector<std::string> collect(const std::string& source); // every .txt in a directory, or a manifest's lines
+  static void report(std::span<const ScriptResult> results, std::ostream& os);
+};
+
 // free function
 void testCommandProcessor();
+void testCommandBatch();
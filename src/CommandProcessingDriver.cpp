@@ -1,5 +1,9 @@
 #include "CommandProcessing.h"
 #include "GameEngine.h"
+#include "Input.h"
+
+#include <filesystem>
+#include <fstream>
 
 void testCommandProcessor() {
   std::cout << "=== Command Processor Test ===" << std::endl;
@@ -8,8 +12,7 @@ void testCommandProcessor() {
   std::cout << "2. File input (-file <filename>)" << std::endl;
   std::cout << "Enter choice: ";
 
-  std::string choice;
-  std::getline(std::cin, choice);
+  const std::string choice = Input::readLine();
 
   CommandProcessor* processor = nullptr;
 
@@ -89,4 +92,42 @@ void testCommandProcessor() {
   // free memory
   delete engine;
   delete processor;
-};
\ No newline at end of file
+};
+
+/**
+ * Runs every script in the commands folder through the batch runner, then the same scripts listed in a manifest,
+ * and checks that both sources and every worker count give the same outcomes.
+ */
+void testCommandBatch() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "COMMAND BATCH TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  const std::vector<std::string> scripts = CommandScriptBatch::collect("commands");
+  std::cout << "1. Found " << scripts.size() << " scripts in commands/\n";
+
+  const std::vector<ScriptResult> pooled = CommandScriptBatch(scripts).run(4);
+  CommandScriptBatch::report(pooled, std::cout);
+
+  // the same scripts through a manifest, plus one that does not exist
+  const std::string manifestPath = "commands_manifest.tmp";
+  {
+    std::ofstream manifest(manifestPath);
+    manifest << "# regression scripts\n";
+    for (const std::string& script : scripts) manifest << std::filesystem::absolute(script).string() << "\n";
+    manifest << "missing.txt\n";
+  }
+
+  const std::vector<ScriptResult> serial = CommandScriptBatch(CommandScriptBatch::collect(manifestPath)).run(1);
+  std::filesystem::remove(manifestPath);
+
+  std::cout << "\n2. Manifest run on one worker:\n";
+  CommandScriptBatch::report(serial, std::cout);
+
+  bool same = serial.size() == pooled.size() + 1 && !serial.back().readable;
+  for (std::size_t i = 0; same && i < pooled.size(); i++) {
+    same = serial[i].accepted == pooled[i].accepted && serial[i].rejected == pooled[i].rejected &&
+           serial[i].finalState == pooled[i].finalState;
+  }
+  std::cout << "\n3. Outcomes match across sources and worker counts: " << (same ? "YES" : "NO") << "\n";
+}
@@ -1,243 +1,349 @@
 #include "GameEngine.h"
+#include "AllocationTracker.h"
 #include "Cards.h"
 #include "CommandProcessing.h"
+#include "GameSnapshot.h"
+#include "Input.h"
 #include "Map.h"
 #include "Orders.h"
 #include "Player.h"
 #include "PlayerStrategies.h"
+#include "Profiler.h"
+#include "Tracer.h"
+#include "TournamentExport.h"
+#include "TournamentSpec.h"
 #include "Utility.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
-#include <map>
+#include <iterator>
 #include <random>
 #include <ranges>
 #include <set>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+
+/*
+ * Save file layout (version 2, native byte order):
+ *   magic "RWZS", version
+ *   state name, map path, turn, random generator state (text)
+ *   player count, then name and strategy key per player
+ *   per player: order count, then type, player slot, target player slot, source, target, soldiers per order
+ *   snapshot word count, then the GameSnapshot words
+ * Tournament checkpoint layout (version 3): magic "RWZT", version, tournament signature, base seed,
+ * in-flight cell, map count, game count, then one result string per cell (empty = not played yet),
+ * then the export file count and the 64-bit size of each export file once the finished games were written.
+ * Strings are length-prefixed; territories are indices into the map's territory list.
+ */
+namespace {
+  constexpr char SAVE_MAGIC[] = {'R', 'W', 'Z', 'S'};
+  constexpr char TOURNAMENT_MAGIC[] = {'R', 'W', 'Z', 'T'};
+  constexpr std::int32_t SAVE_VERSION = 2;
+  constexpr std::int32_t TOURNAMENT_VERSION = 3;
+
+  void putInt(std::string& out, std::int32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
 
+  void putLong(std::string& out, std::int64_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
 
-// ==================== State Class Implementation ====================
-State::State() :
-  name(new std::string("unknown")),
-  transitions(new std::vector<Transition*>()) {}
+  void putString(std::string& out, const std::string& str) {
+    putInt(out, static_cast<std::int32_t>(str.size()));
+    out.append(str);
+  }
 
-State::State(const std::string& newName) :
-  name(new std::string(newName)),
-  transitions(new std::vector<Transition*>()) {}
+  // write next to the target and rename, so a crash mid-write never leaves a truncated file behind
+  bool writeFileAtomically(const std::string& path, const std::string& bytes) {
+    const std::string tmpPath = path + ".tmp";
+    {
+      std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+      if (!file) return false;
+      file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+      if (!file.good()) return false;
+    }
 
-State::State(const State& other) :
-  name(new std::string(*other.name)),
-  transitions(new std::vector<Transition*>()) {
-  // deep copy transitions
-  for (Transition* tran : *other.transitions) {
-    transitions->push_back(new Transition(*tran));
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    return !ec;
   }
-}
 
-State& State::operator=(const State& other) {
-  if (this != &other) {
-    delete name;
-    for (Transition* tran : *transitions) { delete tran; }
-    transitions->clear();
-
-    // deep and shallow copy objects
-    name = new std::string(*other.name);
-    for (Transition* tran : *other.transitions) {
-      transitions->push_back(new Transition(*tran));
+  // bounds-checked cursor over a save file; any overrun clears ok
+  struct SaveReader {
+    const std::string& bytes;
+    std::size_t pos = 0;
+    bool ok = true;
+
+    bool has(std::size_t count) {
+      ok = ok && pos + count <= bytes.size();
+      return ok;
     }
-  }
-  return *this;
-}
 
-State::~State() {
-  delete name;
-  for (Transition* tran : *transitions) { delete tran; }
-  delete transitions;
-}
+    std::int32_t getInt() {
+      std::int32_t value = 0;
+      if (has(sizeof(value))) {
+        std::memcpy(&value, bytes.data() + pos, sizeof(value));
+        pos += sizeof(value);
+      }
+      return value;
+    }
 
-// --- GETTERS ---
-std::string State::getName() const {
-  return *name;
-}
+    std::int64_t getLong() {
+      std::int64_t value = 0;
+      if (has(sizeof(value))) {
+        std::memcpy(&value, bytes.data() + pos, sizeof(value));
+        pos += sizeof(value);
+      }
+      return value;
+    }
+
+    std::string getString() {
+      const std::int32_t size = getInt();
+      if (size < 0 || !has(size)) return "";
+      std::string str = bytes.substr(pos, size);
+      pos += size;
+      return str;
+    }
+  };
 
-Transition* State::getTransition(const std::string& cmd) const {
-  for (Transition* tran : *transitions) {
-    if (tran->getCommand() == cmd) return tran;
+  // a saved order must name everything its type acts on; anything else would fail only once it runs
+  bool completeRecord(const OrderRecord& rec) {
+    if (!rec.player) return false;
+    if (rec.type == ORDER_TYPES::NEGOTIATE) return rec.targetPlayer != nullptr;
+    if (rec.type == ORDER_TYPES::CHEAT) return true;
+    if (!rec.target) return false;
+    if (rec.type == ORDER_TYPES::ADVANCE || rec.type == ORDER_TYPES::AIRLIFT) return rec.source != nullptr;
+    if (rec.type == ORDER_TYPES::BLOCKADE) return rec.targetPlayer != nullptr;
+    return true;
   }
-  return nullptr;
 }
 
-// --- TRANSITION MANAGEMENT ---
-void State::addTransition(Transition* transition) {
-  transitions->push_back(transition);
-}
 
-// --- UTILITY ---
-std::vector<std::string> State::getValidCommands() const {
-  std::vector<std::string> commands;
+// ==================== GameStateMachine Class Implementation ====================
+namespace {
+  // indexed by GameState and GameCommand
+  constexpr std::string_view STATE_NAMES[GAME_STATE_COUNT] = {
+    GAME_PHASES::STARTUP, GAME_STATES::START, GAME_STATES::MAP_LOADED, GAME_STATES::MAP_VALIDATED,
+    GAME_STATES::PLAYERS_ADDED, GAME_PHASES::PLAY, GAME_STATES::ASSIGN_REINFORCEMENT, GAME_STATES::ISSUE_ORDERS,
+    GAME_STATES::EXECUTE_ORDERS, GAME_STATES::WIN
+  };
 
-  for (Transition* tran : *transitions) {
-    commands.push_back(tran->getCommand());
+  constexpr std::string_view COMMAND_NAMES[GAME_COMMAND_COUNT] = {
+    GAME_STATES::START, GAME_TRANSITIONS::LOADMAP, GAME_TRANSITIONS::VALIDATEMAP, GAME_TRANSITIONS::ADDPLAYER,
+    GAME_TRANSITIONS::GAMESTART, GAME_PHASES::PLAY, GAME_TRANSITIONS::ISSUEORDER, GAME_TRANSITIONS::ENDISSUEORDERS,
+    GAME_TRANSITIONS::EXECORDER, GAME_TRANSITIONS::ENDEXECORDERS, GAME_STATES::WIN, GAME_TRANSITIONS::REPLAY,
+    GAME_TRANSITIONS::QUIT
+  };
+
+  // state history journal lines are the state names
+  std::string encodeState(const GameState& state) {
+    return std::string(STATE_NAMES[static_cast<int>(state)]);
   }
-  return commands;
 }
 
-// --- STREAM INSERTION OPERATOR ---
-std::ostream& operator<<(std::ostream& os, const State& st) {
-  os << "State[" << st.getName() << "]" << std::endl;
-  return os;
+// --- QUERIES ---
+std::vector<GameCommand> GameStateMachine::validCommands(GameState state) {
+  std::vector<GameCommand> commands;
+  for (int cmd = 0; cmd < GAME_COMMAND_COUNT; cmd++) {
+    if (next(state, static_cast<GameCommand>(cmd))) commands.push_back(static_cast<GameCommand>(cmd));
+  }
+  return commands;
 }
 
+// --- NAMES ---
+std::string_view GameStateMachine::nameOf(GameState state) {
+  return STATE_NAMES[static_cast<int>(state)];
+}
 
-// ==================== Transition Class Implementation ====================
-Transition::Transition() :
-  command(new std::string("unknown")),
-  targetState(new std::string("unknown")) {}
+std::string_view GameStateMachine::nameOf(GameCommand command) {
+  return COMMAND_NAMES[static_cast<int>(command)];
+}
 
+std::optional<GameState> GameStateMachine::parseState(std::string_view name) {
+  const auto it = std::ranges::find(STATE_NAMES, name);
+  if (it == std::end(STATE_NAMES)) return std::nullopt;
+  return static_cast<GameState>(it - std::begin(STATE_NAMES));
+}
 
-Transition::Transition(const std::string& cmd, const std::string& targSts) :
-  command(new std::string(cmd)),
-  targetState(new std::string(targSts)) {}
+std::optional<GameCommand> GameStateMachine::parseCommand(std::string_view name) {
+  const auto it = std::ranges::find(COMMAND_NAMES, name);
+  if (it == std::end(COMMAND_NAMES)) return std::nullopt;
+  return static_cast<GameCommand>(it - std::begin(COMMAND_NAMES));
+}
 
 
-Transition::Transition(const Transition& other) :
-  command(new std::string(*other.command)),
-  targetState(new std::string(*other.targetState)) {}
+// ==================== GameStandings Class Implementation ====================
+// --- GETTERS ---
+int GameStandings::getActivePlayers() const {
+  return static_cast<int>(active.size());
+}
 
-Transition& Transition::operator=(const Transition& other) {
-  if (this != &other) {
-    delete command;
-    delete targetState;
-    command = new std::string(*other.command);
-    targetState = new std::string(*other.targetState);
-  }
-  return *this;
+bool GameStandings::isDecided() const {
+  return running && active.size() <= 1;
 }
 
-Transition::~Transition() {
-  delete command;
-  delete targetState;
+// --- MANAGEMENT ---
+void GameStandings::start(std::span<Player* const> players) {
+  active.clear();
+  eliminated.clear();
+  running = true;
+
+  for (Player* play : players) {
+    if (play->getTerritoryCount() > 0) {
+      active.push_back(play);
+    } else {
+      eliminated.push_back(play);
+      std::cout << "Player " << play->getName() << " has been eliminated!\n";
+    }
+  }
 }
 
-// --- GETTERS ---
-std::string Transition::getCommand() const {
-  return *command;
+void GameStandings::ownerChanged(Territory* terr, Player* oldOwner) {
+  // orders only ever move armies out of owned territory, so a contender left with nothing stays out
+  if (oldOwner && oldOwner->getTerritoryCount() == 0 && std::erase(active, oldOwner) > 0) {
+    eliminated.push_back(oldOwner);
+    std::cout << "Player " << oldOwner->getName() << " has been eliminated!\n";
+  }
 }
 
-std::string Transition::getTargetState() const {
-  return *targetState;
+void GameStandings::stop() {
+  running = false;
+  active.clear();
+  eliminated.clear();
 }
 
-// --- STREAM INSERTION OPERATOR ---
-std::ostream& operator<<(std::ostream& os, const Transition& tran) {
-  os << "Transition[" << tran.getCommand() << " -> " << tran.getTargetState() << "]" << std::endl;
-  return os;
+std::vector<Player*> GameStandings::takeEliminated() {
+  return std::exchange(eliminated, {});
 }
 
 
 // ==================== GameEngine Class Implementation ====================
-Player* GameEngine::neutralPlayer = nullptr;
-bool GameEngine::automaticMode = false;
+thread_local std::unique_ptr<Player> GameEngine::neutralPlayer;
+thread_local bool GameEngine::automaticMode = false;
+thread_local const std::vector<std::unique_ptr<Player>>* GameEngine::roster = nullptr;
 
 GameEngine::GameEngine() :
   Subject(),
-  currentState(nullptr),
-  states(new std::map<std::string, State*>()),
-  stateHistory(new std::vector<std::string>()),
+  currentState(GameState::STARTUP),
+  stateHistory(STATE_HISTORY_CAPACITY, encodeState),
   gameMap(nullptr),
-  players(new std::vector<Player*>()),
-  deck(new Deck()) {
-  initializeStates();
-  currentState = (*states)[GAME_PHASES::STARTUP];
-  stateHistory->push_back(GAME_PHASES::STARTUP);
+  deck(std::make_unique<Deck>()),
+  currentTurn(1),
+  turnsPlayed(0),
+  rng(std::random_device{}()) {
+  stateHistory.push(GameState::STARTUP);
 }
 
 GameEngine::GameEngine(const GameEngine& other) :
   Subject(other),
-  states(new std::map<std::string, State*>()),
-  stateHistory(new std::vector<std::string>(*other.stateHistory)),
-  gameMap(std::make_unique<Map>(*other.gameMap)),
-  players(new std::vector<Player*>()),
-  deck(new Deck(*other.deck)) {
-  // deep copy states
-  for (const auto& [fst, snd] : *other.states) {
-    (*states)[fst] = new State(*snd);
-  }
-  currentState = (*states)[other.getCurrentStateName()];
-
+  currentState(other.currentState),
+  stateHistory(other.stateHistory),
+  gameMap(other.gameMap ? std::make_unique<Map>(*other.gameMap) : nullptr),
+  deck(std::make_unique<Deck>(*other.deck)),
+  mapPath(other.mapPath),
+  currentTurn(other.currentTurn),
+  turnsPlayed(other.turnsPlayed),
+  rng(other.rng) {
   // deep copy players
-  for (auto& play : *other.players) {
-    players->push_back(new Player(*play));
+  for (const auto& play : other.players) {
+    players.push_back(std::make_unique<Player>(*play));
   }
 }
 
 GameEngine& GameEngine::operator=(const GameEngine& other) {
   if (this != &other) {
     Subject::operator=(other);
-    cleanupStates();
-    delete states;
-    delete stateHistory;
-
-    states = new std::map<std::string, State*>();
-    stateHistory = new std::vector<std::string>(*other.stateHistory);
-
-    for (const auto& [fst, snd] : *other.states) {
-      (*states)[fst] = new State(*snd);
-    }
-    currentState = (*states)[other.getCurrentStateName()];
+    currentState = other.currentState;
+    stateHistory = other.stateHistory;
 
     // smart pointer map
     if (other.gameMap) gameMap = std::make_unique<Map>(*other.gameMap);
     else gameMap.reset();
 
-    for (auto& play : *players) { delete play; }
-    players->clear();
-
-    for (auto& play : *other.players) {
-      players->push_back(new Player(*play));
+    players.clear();
+    for (const auto& play : other.players) {
+      players.push_back(std::make_unique<Player>(*play));
     }
 
-    deck = new Deck(*other.deck);
+    deck = std::make_unique<Deck>(*other.deck);
+    mapPath = other.mapPath;
+    currentTurn = other.currentTurn;
+    turnsPlayed = other.turnsPlayed;
+    rng = other.rng;
   }
   return *this;
 }
 
-GameEngine::~GameEngine() {
-  cleanupStates();
-  delete states;
-  delete stateHistory;
-  delete deck;
-  for (auto& play : *players) { delete play; }
-  players->clear();
-}
+GameEngine::~GameEngine() = default;
 
 // --- GETTERS --
+GameState GameEngine::getCurrentState() const {
+  return currentState;
+}
+
 std::string GameEngine::getCurrentStateName() const {
-  return currentState->getName();
+  return std::string(GameStateMachine::nameOf(currentState));
+}
+
+std::vector<Player*> GameEngine::getPlayers() const {
+  std::vector<Player*> view;
+  view.reserve(players.size());
+  for (const auto& play : players) view.push_back(play.get());
+  return view;
+}
+
+Map* GameEngine::getMap() const {
+  return gameMap.get();
+}
+
+Deck* GameEngine::getDeck() const {
+  return deck.get();
 }
 
-const std::vector<Player*>& GameEngine::getPlayers() const {
-  return *players;
+int GameEngine::getCurrentTurn() const {
+  return currentTurn;
+}
+
+int GameEngine::getTurnsPlayed() const {
+  return turnsPlayed;
 }
 
 Player* GameEngine::getNeutralPlayer() {
-  if (!neutralPlayer) neutralPlayer = new Player("Neutral", nullptr);
-  return neutralPlayer;
+  if (!neutralPlayer) neutralPlayer = std::make_unique<Player>("Neutral", nullptr);
+  return neutralPlayer.get();
 }
 
 bool GameEngine::getAutomaticMode() {
   return automaticMode;
 }
 
+std::span<const std::unique_ptr<Player>> GameEngine::getRoster() {
+  if (!roster) return {};
+  return *roster;
+}
+
 // --- SETTERS --
 void GameEngine::setMap(Map* map) {
   gameMap = std::make_unique<Map>(std::move(*map));
 }
 
-void GameEngine::setDeck(Deck* newDeck) {
-  deck = newDeck;
+void GameEngine::setDeck(std::unique_ptr<Deck> newDeck) {
+  deck = std::move(newDeck);
+}
+
+void GameEngine::setCheckpointFile(const std::string& path) {
+  checkpointPath = path;
+}
+
+bool GameEngine::setStateJournal(const std::string& path) {
+  return stateHistory.setJournal(path);
 }
 
 void GameEngine::setAutomaticMode(bool mode) {
@@ -245,8 +351,8 @@ void GameEngine::setAutomaticMode(bool mode) {
 }
 
 // --- PLAYER MANAGEMENT --
-void GameEngine::addPlayer(Player* player) {
-  players->push_back(player);
+void GameEngine::addPlayer(std::unique_ptr<Player> player) {
+  if (player) players.push_back(std::move(player));
 }
 
 // --- STARTUP PHASE MANAGEMENT --
@@ -261,7 +367,9 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
             << "  loadmap <path-or-name>\n"
             << "  validatemap\n"
             << "  addplayer <playername>\n"
-            << "  gamestart\n";
+            << "  gamestart\n"
+            << "  savegame <file>\n"
+            << "  loadgame <file>\n";
 
   // show available map files under /maps
   const fs::path cwd = fs::current_path();
@@ -291,7 +399,10 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
     if (!cmd) break;
 
     std::string line = trimCopy(cmd->getCommand());
-    if (line.empty()) continue;
+    if (line.empty()) {
+      if (!cmdSrc.hasMoreCommands()) break; // the source ran dry before the game could start
+      continue;
+    }
 
     // validate command against current state
     if (!cmdSrc.validate(line, this)) {
@@ -310,8 +421,8 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
     iss >> baseCmd;
 
     if (baseCmd == GAME_STATES::START) {
-      if (getCurrentStateName() == GAME_PHASES::STARTUP) {
-        transitionState(GAME_STATES::START);
+      if (currentState == GameState::STARTUP) {
+        transitionState(GameState::START);
         std::cout << "Transitioned to 'start'. Now you can use 'loadmap <file>'.\n\n";
         cmd->saveEffect("state -> start");
       } else {
@@ -341,11 +452,12 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
       }
 
       gameMap = std::move(loaded);
+      mapPath = candidate.string();
       hasLoaded = true;
       isValid = false;
 
       std::cout << "Success: map loaded: " << gameMap->getName() << "\n";
-      transitionState(GAME_STATES::MAP_LOADED);
+      transitionState(GameState::MAP_LOADED);
       std::cout << "\nNext: type 'validatemap'\n";
       cmd->saveEffect("Map loaded; state -> map loaded");
     } else if (baseCmd == GAME_TRANSITIONS::VALIDATEMAP) {
@@ -372,7 +484,7 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
       std::cout << "Overall Result: " << (overallValid ? "VALID MAP" : "INVALID MAP") << std::endl;
 
       if (overallValid) {
-        transitionState(GAME_STATES::MAP_VALIDATED);
+        transitionState(GameState::MAP_VALIDATED);
         isValid = true;
 
         // summary
@@ -404,14 +516,14 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
       }
 
       // must be 2-6 players
-      if (players->size() >= 6) {
+      if (players.size() >= 6) {
         std::cout << "Maximum of 6 players reached.\n";
         cmd->saveEffect("Too many players");
         continue;
       }
 
       bool duplicate = false;
-      for (auto* play : *players) {
+      for (const auto& play : players) {
         if (play && play->getName() == name) {
           duplicate = true;
           break;
@@ -423,33 +535,33 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
         continue;
       }
 
-      auto* np = new Player(name, nullptr);
+      auto np = std::make_unique<Player>(name, deck.get());
 
       // assign default strategy based on automatic mode
       // in tournament/automatic mode, strategies will be set separately
       // in regular mode, assign strategies in round-robin fashion for testing
       if (automaticMode) {
-        np->setStrategy(new NeutralPlayerStrategy(np));
+        np->setStrategy(std::make_unique<NeutralPlayerStrategy>(np.get()));
       } else {
-        const size_t playerIndex = players->size();
+        const size_t playerIndex = players.size();
         switch (playerIndex % 4) { // this ensures each player has a valid strategy to avoid infinite loops
-          case 0: np->setStrategy(new AggressivePlayerStrategy(np)); break;
-          case 1: np->setStrategy(new BenevolentPlayerStrategy(np)); break;
-          case 2: np->setStrategy(new NeutralPlayerStrategy(np)); break;
-          case 3: np->setStrategy(new CheaterPlayerStrategy(np)); break;
-          default: np->setStrategy(new AggressivePlayerStrategy(np)); break;
+          case 0: np->setStrategy(std::make_unique<AggressivePlayerStrategy>(np.get())); break;
+          case 1: np->setStrategy(std::make_unique<BenevolentPlayerStrategy>(np.get())); break;
+          case 2: np->setStrategy(std::make_unique<NeutralPlayerStrategy>(np.get())); break;
+          case 3: np->setStrategy(std::make_unique<CheaterPlayerStrategy>(np.get())); break;
+          default: np->setStrategy(std::make_unique<AggressivePlayerStrategy>(np.get())); break;
         }
         std::cout << "Assigned " << *np->getPlayerStrategy()->getStrategy() << " strategy to " << name << "\n";
       }
 
-      players->push_back(np);
-      transitionState(GAME_STATES::PLAYERS_ADDED);
+      players.push_back(std::move(np));
+      transitionState(GameState::PLAYERS_ADDED);
 
       std::cout << "Added player: " << name << "\n";
-      std::cout << "Current players (" << players->size() << "): ";
-      for (size_t i = 0; i < players->size(); ++i) {
-        std::cout << (*players)[i]->getName();
-        if (i < players->size() - 1) { std::cout << ", "; }
+      std::cout << "Current players (" << players.size() << "): ";
+      for (size_t i = 0; i < players.size(); ++i) {
+        std::cout << players[i]->getName();
+        if (i < players.size() - 1) { std::cout << ", "; }
       }
 
       std::cout << "\nHint: add between 2 and 6 players total, then type 'gamestart'.\n\n";
@@ -465,8 +577,8 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
         cmd->saveEffect("Map not validated");
         continue;
       }
-      if (players->size() < 2 || players->size() > 6) {
-        std::cout << "'gamestart' requires between 2 and 6 players -> Current: " << players->size() << "\n";
+      if (players.size() < 2 || players.size() > 6) {
+        std::cout << "'gamestart' requires between 2 and 6 players -> Current: " << players.size() << "\n";
         cmd->saveEffect("Invalid player count");
         continue;
       }
@@ -482,12 +594,11 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
         allTerritories.push_back(terr.get());
       }
 
-      std::mt19937 rng(std::random_device{}());
       std::ranges::shuffle(allTerritories, rng);
       for (size_t i = 0; i < allTerritories.size(); ++i) {
         Territory* terr = allTerritories[i];
         Player* oldOwner = terr->getOwner();
-        Player* newOwner = (*players)[i % players->size()];
+        Player* newOwner = players[i % players.size()].get();
 
         if (oldOwner && oldOwner != newOwner) oldOwner->removeTerritory(terr);
         if (!newOwner->ownsTerritory(terr)) newOwner->addTerritory(terr);
@@ -495,16 +606,15 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
       }
 
       // randomize play order
-      std::ranges::shuffle(*players, rng);
+      std::ranges::shuffle(players, rng);
       // 50 armies each
-      for (auto* play : *players) play->setReinforcementPool(50);
+      for (const auto& play : players) play->setReinforcementPool(50);
 
       // draw 2 initial cards each
       if (deck) {
-        for (auto* play : *players) {
+        for (const auto& play : players) {
           for (int j = 0; j < 2; ++j) {
-            Card* card = deck->draw();
-            if (card) play->addCard(card);
+            if (const auto card = deck->draw(rng)) play->addCard(*card);
           }
         }
       }
@@ -512,41 +622,89 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
       // output
       std::cout << "\n=== TERRITORY DISTRIBUTION RESULTS ===\n";
       std::cout << "Total territories on map: " << allTerritories.size() << "\n";
-      std::cout << "Number of players: " << players->size() << "\n";
-      for (auto* play : *players) {
+      std::cout << "Number of players: " << players.size() << "\n";
+      for (const auto& play : players) {
         std::cout << " - " << play->getName() << " received " << play->getTerritoryCount() << " territories.\n";
       }
 
       std::cout << "\n=== PLAYER ORDER ===\nPlay order: ";
-      for (size_t i = 0; i < players->size(); ++i) {
-        std::cout << (*players)[i]->getName();
-        if (i < players->size() - 1) { std::cout << " -> "; }
+      for (size_t i = 0; i < players.size(); ++i) {
+        std::cout << players[i]->getName();
+        if (i < players.size() - 1) { std::cout << " -> "; }
       }
       std::cout << "\n";
 
       std::cout << "\n=== REINFORCEMENT POOLS ===\n";
-      for (auto* play : *players) {
+      for (const auto& play : players) {
         std::cout << " - " << play->getName() << " starts with " << play->getReinforcementPool() << " armies.\n";
       }
 
       std::cout << "\n=== INITIAL CARDS DRAWN ===\n";
-      for (auto* play : *players) {
+      for (const auto& play : players) {
         std::cout << play->getName() << " drew 2 cards and now has\n ";
         play->getHand()->displayInfo();
         std::cout << "\n";
       }
 
-      transitionState(GAME_PHASES::PLAY);
+      transitionState(GameState::PLAY);
       std::cout << "'gamestart' complete. Transitioned to 'play' phase.\n";
       std::cout << "Current Game State: " << getCurrentStateName() << "\n";
       cmd->saveEffect("Game started; state -> play");
       break; // leave startup loop
+    } else if (baseCmd == GAME_TRANSITIONS::SAVEGAME) {
+      std::string arg;
+      std::getline(iss, arg);
+      arg = trimCopy(arg);
+
+      if (arg.empty()) {
+        std::cout << "Usage: savegame <file>\n";
+        cmd->saveEffect("Missing path");
+        continue;
+      }
+
+      if (saveGame(arg)) {
+        std::cout << "Game saved to " << arg << "\n";
+        cmd->saveEffect("Game saved");
+      } else {
+        std::cout << "Error: could not save the game (load a map first).\n";
+        cmd->saveEffect("Game saving failed");
+      }
+    } else if (baseCmd == GAME_TRANSITIONS::LOADGAME) {
+      std::string arg;
+      std::getline(iss, arg);
+      arg = trimCopy(arg);
+
+      if (arg.empty()) {
+        std::cout << "Usage: loadgame <file>\n";
+        cmd->saveEffect("Missing path");
+        continue;
+      }
+
+      if (!loadGame(arg)) {
+        std::cout << "Error: could not load saved game " << arg << "\n";
+        cmd->saveEffect("Game loading failed");
+        continue;
+      }
+
+      hasLoaded = true;
+      isValid = true;
+      std::cout << "Game loaded: " << players.size() << " players, turn " << currentTurn
+                << ", state '" << getCurrentStateName() << "'.\n";
+      cmd->saveEffect("Game loaded; state -> " + getCurrentStateName());
+
+      // a game saved after gamestart resumes straight into the main game loop
+      if (
+        currentState != GameState::STARTUP && currentState != GameState::START && currentState != GameState::MAP_LOADED &&
+        currentState != GameState::MAP_VALIDATED && currentState != GameState::PLAYERS_ADDED
+      ) break;
     } else if (baseCmd == "help") {
       std::cout << "Commands:\n"
                 << "  loadmap <path-or-name>\n"
                 << "  validatemap\n"
                 << "  addplayer <name>\n"
-                << "  gamestart\n";
+                << "  gamestart\n"
+                << "  savegame <file>\n"
+                << "  loadgame <file>\n";
       cmd->saveEffect("Help shown");
     } else {
       std::cout << "Unknown command. Try 'help'.\n";
@@ -560,41 +718,25 @@ void GameEngine::startupPhase(CommandProcessor& cmdSrc) {
 // --- ORDERS MANAGEMENT --
 void GameEngine::reinforcementPhase() {
   std::cout << "\n--- REINFORCEMENT PHASE ---\n";
-  transitionState(GAME_STATES::ASSIGN_REINFORCEMENT);
+  transitionState(GameState::ASSIGN_REINFORCEMENT);
 
-  for (Player* player : *players) {
-    int reinforcement = std::max(3, static_cast<int>(player->getTerritories().size()) / 3);
+  // territory counts and continent ownership for every player in one pass over the map
+  const MapTally tally = gameMap->tally(getPlayers());
+  const auto& continents = gameMap->getContinents();
 
-    // add continent bonuses
-    std::map<Continent*, bool> continentOwnership;
-    const auto& continents = gameMap->getContinents();
-
-    // initialize all continents as potentially owned
-    for (const auto& continent : continents) {
-      continentOwnership[continent.get()] = true;
-    }
-
-    // check each continent to see if the player owns all territories
-    for (const auto& continent : continents) {
-      for (const auto& territory : continent->getTerritories()) {
-        if (territory->getOwner() != player) {
-          continentOwnership[continent.get()] = false;
-          break;
-        }
-      }
-    }
+  for (std::size_t p = 0; p < players.size(); p++) {
+    const auto& player = players[p];
+    int reinforcement = std::max(3, tally.players[p].territories / 3);
 
     // add bonuses for owned continents
-    int continentBonus = 0;
-    for (const auto& [fst, snd] : continentOwnership) {
-      if (snd) {
-        continentBonus += fst->getBonus();
+    for (std::size_t c = 0; c < continents.size(); c++) {
+      if (tally.continentOwners[c] == static_cast<int>(p)) {
         std::cout << "  " << player->getName() << " controls all of "
-                  << fst->getName() << " (+" << fst->getBonus() << " bonus)\n";
+                  << continents[c]->getName() << " (+" << continents[c]->getBonus() << " bonus)\n";
       }
     }
 
-    reinforcement += continentBonus;
+    reinforcement += tally.players[p].continentBonus;
     int totalReinforcement = reinforcement + player->getPendingReinforcements();
 
     player->setReinforcementPool(totalReinforcement);
@@ -606,23 +748,34 @@ void GameEngine::reinforcementPhase() {
 
 void GameEngine::issueOrdersPhase() {
   std::cout << "\n--- ISSUING ORDERS PHASE ---\n";
-  transitionState(GAME_STATES::ISSUE_ORDERS);
+  transitionState(GameState::ISSUE_ORDERS);
+
+  // while a human player is deciding, the computer players work out their territory lists ahead of their turn;
+  // those are memoized against the map state, which issuing orders does not change
+  Input::IdleScope precompute([this] {
+    for (const auto& play : players) {
+      if (play->getCanIssueOrder() && !dynamic_cast<HumanPlayerStrategy*>(play->getPlayerStrategy())) {
+        play->toDefend();
+        play->toAttack();
+      }
+    }
+  });
 
   bool allDone = false;
   while (!allDone) {
     allDone = true;
-    for (Player* play : *players) {
-      if (*(play->getCanIssueOrder())) {
+    for (const auto& play : players) {
+      if (play->getCanIssueOrder()) {
         play->issueOrder();
         allDone = false;
       }
     }
   }
 
-  for (Player* play : *players) {
+  for (const auto& play : players) {
     play->setCanIssueOrder(true);
     if (play->getGotAttackedThisTurn() && *(play->getPlayerStrategy()->getStrategy()) == "Neutral Player Strategy") {
-      play->setStrategy(new AggressivePlayerStrategy(play));
+      play->setStrategy(std::make_unique<AggressivePlayerStrategy>(play.get()));
     }
   }
   std::cout << "\nAll players have finished issuing orders.\n";
@@ -630,125 +783,335 @@ void GameEngine::issueOrdersPhase() {
 
 void GameEngine::executeOrdersPhase() {
   std::cout << "\n--- ORDERS EXECUTION PHASE ---\n";
-  transitionState(GAME_STATES::EXECUTE_ORDERS);
+  transitionState(GameState::EXECUTE_ORDERS);
 
-  // first: execute all deploy orders in round-robin fashion
+  // each step takes its orders in round-robin fashion and validates them together before running any
+  OrderBatch batch;
+  const std::vector<Player*> roster = getPlayers();
+
+  // first: execute all deploy orders
   bool deploysLeft = true;
   while (deploysLeft) {
     deploysLeft = false;
 
-    for (Player* play : *players) {
-      auto* orders = play->getOrders()->orders;
-
-      if (!orders->empty()) {
-        Order* order = orders->front();
-        if (dynamic_cast<OrderDeploy*>(order)) {
-          order->execute();
-          std::cout << "Executed deploy order for " << play->getName() << "\n";
+    for (const auto& play : players) {
+      OrdersList* orders = play->getOrders();
 
-          orders->erase(orders->begin());
-          delete order;
-          deploysLeft = true;
-        }
+      if (!orders->orders.empty() && dynamic_cast<OrderDeploy*>(orders->orders.front().get())) {
+        batch.add(play.get(), orders->popFront());
+        deploysLeft = true;
       }
     }
   }
 
-  // then: execute other orders in round-robin fashion
+  batch.validateAll(roster);
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    {
+      PROFILE_SCOPE(ProfileCategory::ORDER, batch.getOrder(i)->getType());
+      batch.execute(i);
+    }
+    std::cout << "Executed deploy order for " << batch.getIssuer(i)->getName() << "\n";
+  }
+  batch.clear();
+
+  // then: execute other orders, deploys left behind them are dropped
   bool ordersLeft = true;
   while (ordersLeft) {
     ordersLeft = false;
-    for (Player* play : *players) {
-      auto* orders = play->getOrders()->orders;
-
-      if (!orders->empty()) {
-        Order* order = orders->front();
-        if (!dynamic_cast<OrderDeploy*>(order)) { order->execute(); }
-
-        delete order;
-        orders->erase(orders->begin());
+    for (const auto& play : players) {
+      if (std::unique_ptr<Order> order = play->getOrders()->popFront()) {
+        if (!dynamic_cast<OrderDeploy*>(order.get())) batch.add(play.get(), std::move(order));
         ordersLeft = true;
       }
     }
   }
 
+  batch.validateAll(roster);
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    {
+      PROFILE_SCOPE(ProfileCategory::ORDER, batch.getOrder(i)->getType());
+      batch.execute(i);
+    }
+
+    // the game is over the moment the last rival falls, the rest of the batch never runs
+    if (standings.isDecided()) {
+      std::cout << "The game has been decided, " << batch.size() - i - 1 << " remaining orders dropped.\n";
+      batch.clear();
+      return;
+    }
+  }
+
   std::cout << "All Orders Executed\n";
 }
 
 // --- MAIN GAME LOOP MANAGEMENT --
 std::string GameEngine::mainGameLoop(int maxTurns) {
-  int turn = 1;
+  int& turn = currentTurn; // starts at 1, or at the saved turn after loadgame
   bool gameOver = false;
   std::string winner = "Draw";
 
   std::cout << "\n=== Starting Main Game Loop ===" << std::endl;
-  if (players->empty() || !gameMap) {
+  if (players.empty() || !gameMap) {
     std::cout << "Error: Cannot start main game loop without players and map.\n";
     return "";
   }
+  PROFILE_SCOPE(ProfileCategory::GAME, "game");
+  const GameRandom::Scope random(rng);
+
+  // cards played during the game pick their target players from this roster
+  const std::vector<std::unique_ptr<Player>>* previousRoster = std::exchange(roster, &players);
+
+  // whoever observes the engine also observes the orders its players issue
+  for (const auto& play : players) {
+    for (Observer* obs : observers) play->getOrders()->attach(obs);
+  }
+
+  // eliminations are tracked as territories change hands
+  standings.start(getPlayers());
+  gameMap->setOwnershipListener(&standings);
 
   while (!gameOver && (maxTurns == -1 ? true : turn <= maxTurns)) {
     std::cout << "\n=== Turn " << turn << " ===" << std::endl;
+    PROFILE_SCOPE(ProfileCategory::GAME, "turn");
 
-    // clear negotiation records at the start of each turn
-    Order::clearNegotiationRecords();
+    // forget last turn's negotiations at the start of each turn
+    Order::resetNegotiations();
 
     // reset conquered flag for all players
-    for (Player* play : *players) {
+    for (const auto& play : players) {
       play->setConqueredThisTurn(false);
     }
 
     // reinforcement Phase
-    reinforcementPhase();
+    {
+      PROFILE_SCOPE(ProfileCategory::PHASE, "reinforcement");
+      reinforcementPhase();
+    }
     // issue Orders Phase
-    issueOrdersPhase();
+    {
+      PROFILE_SCOPE(ProfileCategory::PHASE, "issue orders");
+      issueOrdersPhase();
+    }
     // execute Orders Phase
-    executeOrdersPhase();
+    {
+      PROFILE_SCOPE(ProfileCategory::PHASE, "execute orders");
+      executeOrdersPhase();
+    }
 
     // give cards to players who conquered territories
-    for (Player* play : *players) {
-      if (play->getConqueredThisTurn() && deck) {
-        Card* drawnCard = deck->draw();
-        if (drawnCard) {
-          play->addCard(drawnCard);
-          std::cout << play->getName() << " conquered a territory this turn and receives a card!\n";
+    if (!standings.isDecided()) {
+      PROFILE_SCOPE(ProfileCategory::PHASE, "card draws");
+      for (const auto& play : players) {
+        if (play->getConqueredThisTurn() && deck) {
+          if (const auto drawnCard = deck->draw(rng)) {
+            play->addCard(*drawnCard);
+            std::cout << play->getName() << " conquered a territory this turn and receives a card!\n";
+          }
         }
       }
     }
 
     // --- remove eliminated players ---
-    for (auto it = players->begin(); it != players->end();) {
-      Player* play = *it;
-
-      if (play->getTerritories().empty()) {
-        std::cout << "Player " << play->getName() << " has been eliminated!\n";
-        delete play;
-        it = players->erase(it);
-      } else { ++it; }
+    {
+      PROFILE_SCOPE(ProfileCategory::PHASE, "elimination");
+      for (const Player* play : standings.takeEliminated()) {
+        std::erase_if(players, [play](const std::unique_ptr<Player>& p) { return p.get() == play; });
+      }
     }
 
     // --- check win condition ---
-    if (players->size() == 1) {
-      winner = players->front()->getName();
-      transitionState(GAME_STATES::WIN);
+    if (standings.getActivePlayers() == 1) {
+      winner = players.front()->getName();
+      transitionState(GameState::WIN);
       gameOver = true;
-    } else if (players->empty()) {
+    } else if (standings.getActivePlayers() == 0) {
       winner = "Draw";
       gameOver = true;
     }
 
     turn++;
+
+    // checkpoint between turns, when no orders are in flight
+    if (!gameOver && !checkpointPath.empty()) saveGame(checkpointPath);
   }
 
+  gameMap->setOwnershipListener(nullptr);
+  standings.stop();
+
   // if we hit max turns without a winner, it's a draw
   if (maxTurns > 0 && turn > maxTurns && !gameOver) {
     winner = "Draw";
   }
 
+  // the next game starts from the first turn again
+  turnsPlayed = turn - 1;
+  turn = 1;
+
+  roster = previousRoster;
   std::cout << "Game Over. Thanks for playing!" << std::endl;
   return winner;
 }
 
+// --- SAVE AND LOAD --
+/**
+ * write the whole game (state, players, strategies, pending orders and a GameSnapshot) to a binary file
+ * @param path file to write
+ * @return false if there is no map to save or the file could not be written
+ */
+bool GameEngine::saveGame(const std::string& path) const {
+  if (!gameMap) return false;
+
+  const auto& territories = gameMap->getTerritories();
+  std::unordered_map<const Territory*, std::int32_t> terrIndex;
+  for (std::size_t i = 0; i < territories.size(); ++i) {
+    terrIndex[territories[i].get()] = static_cast<std::int32_t>(i);
+  }
+
+  auto terrSlot = [&terrIndex](const Territory* terr) -> std::int32_t {
+    const auto it = terrIndex.find(terr);
+    return it != terrIndex.end() ? it->second : -1;
+  };
+  auto playerSlot = [this](const Player* play) -> std::int32_t {
+    if (!play) return -1;
+    const auto it = std::ranges::find(players, play, &std::unique_ptr<Player>::get);
+    return static_cast<std::int32_t>(it - players.begin());
+  };
+
+  std::string out;
+  out.append(SAVE_MAGIC, sizeof(SAVE_MAGIC));
+  putInt(out, SAVE_VERSION);
+  putString(out, getCurrentStateName());
+  putString(out, mapPath);
+  putInt(out, currentTurn);
+
+  // the generator's state, so a resumed game rolls exactly as the original would have
+  std::ostringstream random;
+  random << rng;
+  putString(out, random.str());
+
+  putInt(out, static_cast<std::int32_t>(players.size()));
+  for (const auto& play : players) {
+    putString(out, play->getName());
+    putString(out, PlayerStrategy::keyOf(play->getPlayerStrategy()));
+  }
+
+  for (const auto& play : players) {
+    const auto& orders = play->getOrders()->orders;
+    putInt(out, static_cast<std::int32_t>(orders.size()));
+
+    for (const auto& order : orders) {
+      const OrderRecord rec = order->toRecord();
+      putString(out, rec.type);
+      putInt(out, playerSlot(rec.player));
+      putInt(out, playerSlot(rec.targetPlayer));
+      putInt(out, terrSlot(rec.source));
+      putInt(out, terrSlot(rec.target));
+      putInt(out, rec.soldiers);
+    }
+  }
+
+  GameSnapshot snapshot;
+  snapshot.capture(*this);
+  const auto& words = snapshot.getBuffer();
+  putInt(out, static_cast<std::int32_t>(words.size()));
+  out.append(reinterpret_cast<const char*>(words.data()), snapshot.sizeInBytes());
+
+  return writeFileAtomically(path, out);
+}
+
+/**
+ * replace the current game with one written by saveGame; the current game is untouched if loading fails
+ * @param path file to read
+ * @return false if the file is missing, corrupt, from another version, or its map cannot be loaded
+ */
+bool GameEngine::loadGame(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+
+  const std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  SaveReader in{bytes};
+
+  if (!in.has(sizeof(SAVE_MAGIC)) || std::memcmp(bytes.data(), SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) return false;
+  in.pos += sizeof(SAVE_MAGIC);
+  if (in.getInt() != SAVE_VERSION) return false;
+
+  const std::optional<GameState> savedState = GameStateMachine::parseState(in.getString());
+  const std::string savedMapPath = in.getString();
+  const std::int32_t savedTurn = in.getInt();
+  std::istringstream random(in.getString());
+  std::mt19937 savedRng;
+  random >> savedRng;
+  const std::int32_t playerCount = in.getInt();
+  if (!in.ok || !savedState || !random || playerCount < 0) return false;
+
+  // topology comes from the map file; everything mutable comes from the snapshot
+  MapLoader loader;
+  auto loadedMap = loader.loadMap(savedMapPath);
+  if (!loadedMap || !loadedMap->validate()) return false;
+
+  const auto& territories = loadedMap->getTerritories();
+  auto loadedDeck = std::make_unique<Deck>();
+  std::vector<std::unique_ptr<Player>> loadedPlayers;
+  std::vector<Player*> loadedView; // the snapshot restores through plain pointers
+
+  for (std::int32_t i = 0; i < playerCount && in.ok; ++i) {
+    const std::string name = in.getString();
+    const std::string key = in.getString();
+
+    auto play = std::make_unique<Player>(name, loadedDeck.get());
+    std::unique_ptr<PlayerStrategy> strategy = PlayerStrategy::create(key, play.get());
+    play->setStrategy(strategy ? std::move(strategy) : std::make_unique<NeutralPlayerStrategy>(play.get()));
+    loadedView.push_back(play.get());
+    loadedPlayers.push_back(std::move(play));
+  }
+
+  // slots past the roster name the neutral player only when they are exactly one past it
+  auto playerAt = [&loadedView, playerCount](std::int32_t slot) -> Player* {
+    if (slot < 0 || slot > playerCount) return nullptr;
+    return slot < playerCount ? loadedView[slot] : getNeutralPlayer();
+  };
+  auto terrAt = [&territories](std::int32_t idx) -> Territory* {
+    return idx >= 0 && idx < static_cast<std::int32_t>(territories.size()) ? territories[idx].get() : nullptr;
+  };
+
+  for (Player* play : loadedView) {
+    const std::int32_t orderCount = in.getInt();
+    for (std::int32_t i = 0; i < orderCount && in.ok; ++i) {
+      OrderRecord rec;
+      rec.type = in.getString();
+      rec.player = playerAt(in.getInt());
+      rec.targetPlayer = playerAt(in.getInt());
+      rec.source = terrAt(in.getInt());
+      rec.target = terrAt(in.getInt());
+      rec.soldiers = in.getInt();
+
+      std::unique_ptr<Order> order = in.ok && completeRecord(rec) ? Order::fromRecord(rec) : nullptr;
+      if (!order) return false;
+      play->getOrders()->addOrder(std::move(order));
+    }
+  }
+
+  const std::int32_t wordCount = in.getInt();
+  if (!in.ok || wordCount < 0 || !in.has(wordCount * sizeof(std::int32_t))) return false;
+
+  std::vector<std::int32_t> words(wordCount);
+  std::memcpy(words.data(), bytes.data() + in.pos, wordCount * sizeof(std::int32_t));
+
+  GameSnapshot snapshot;
+  snapshot.setBuffer(words);
+  if (!snapshot.restore(*loadedMap, loadedView, loadedDeck.get())) return false;
+
+  // everything checked out: swap the loaded game in
+  players = std::move(loadedPlayers);
+  deck = std::move(loadedDeck);
+  gameMap = std::move(loadedMap);
+  mapPath = savedMapPath;
+  currentTurn = savedTurn;
+  rng = savedRng;
+  transitionState(*savedState);
+  return true;
+}
+
 // --- TOURNAMENT MODE MANAGEMENT --
 /**
  * parse and execute a tournament command
@@ -758,17 +1121,64 @@ void GameEngine::executeTournament(const std::string& cmd) {
   std::cout << "\n=== TOURNAMENT MODE ===\n";
   std::cout << "Parsing tournament command...\n";
 
+  // a spec file describes a whole sweep, played across every worker thread
+  if (const std::size_t fPos = cmd.find("-F "); fPos != std::string::npos) {
+    std::string specFile = cmd.substr(fPos + 3);
+    specFile.erase(0, specFile.find_first_not_of(" \t\n\r"));
+    specFile.erase(specFile.find_last_not_of(" \t\n\r") + 1);
+
+    std::string error;
+    const std::optional<TournamentSpec> spec = TournamentSpec::load(specFile, error);
+    if (!spec) {
+      std::cout << "Error: " << error << "\n";
+      return;
+    }
+
+    std::cout << "\nTournament Spec: " << specFile << "\n";
+    std::cout << "Maps: " << spec->getMaps().size() << ", Lineups: " << spec->getLineups().size()
+              << ", Turn Limits: " << spec->getTurns().size() << ", Seeds: " << spec->getSeeds().size() << "\n";
+    std::cout << "Games To Play: " << spec->jobCount() << "\n";
+    for (const std::string& file : spec->getOutputs()) std::cout << "Exporting Results To: " << file << "\n";
+    std::cout << std::flush;
+
+    const SweepSummary sweep = TournamentSweep::run(*spec);
+
+    std::ostringstream summary;
+    TournamentSweep::report(*spec, sweep, summary);
+    std::cout << "\n" << summary.view();
+
+    std::ofstream logFile(GAMELOG_FILE, std::ios::app);
+    if (logFile.is_open()) { logFile << "\nTournament spec " << specFile << "\n" << summary.view(); }
+    std::cout << "\n=== TOURNAMENT COMPLETE ===\n";
+    return;
+  }
+
   // find flag positions
   std::size_t mPos = cmd.find("-M ");
   std::size_t pPos = cmd.find("-P ");
   std::size_t gPos = cmd.find("-G ");
   std::size_t dPos = cmd.find("-D ");
 
+  // optional flags follow -D in any order: -C <checkpoint file>, -O <export files>, -T <trace file>
+  auto nextOption = [&cmd](std::size_t from) {
+    return std::min({cmd.find("-C ", from), cmd.find("-O ", from), cmd.find("-T ", from)});
+  };
+  auto optionValue = [&cmd, dPos, &nextOption](const char* flag) -> std::string {
+    const std::size_t pos = cmd.find(flag, dPos);
+    if (pos == std::string::npos) return "";
+    const std::size_t end = nextOption(pos + 3);
+    return cmd.substr(pos + 3, end == std::string::npos ? std::string::npos : end - pos - 3);
+  };
+  const std::size_t optPos = nextOption(dPos);
+
   // extract parameter strings
   std::string mapsStr = cmd.substr(mPos + 3, pPos - mPos - 3);
   std::string playersStr = cmd.substr(pPos + 3, gPos - pPos - 3);
   std::string gamesStr = cmd.substr(gPos + 3, dPos - gPos - 3);
-  std::string turnsStr = cmd.substr(dPos + 3);
+  std::string turnsStr = cmd.substr(dPos + 3, optPos == std::string::npos ? std::string::npos : optPos - dPos - 3);
+  std::string checkpointStr = optionValue("-C ");
+  std::string outputStr = optionValue("-O ");
+  std::string traceStr = optionValue("-T ");
 
   // helper lambda to trim whitespace
   auto trim = [](std::string& s) {
@@ -785,6 +1195,9 @@ void GameEngine::executeTournament(const std::string& cmd) {
   trim(playersStr);
   trim(gamesStr);
   trim(turnsStr);
+  trim(checkpointStr);
+  trim(outputStr);
+  trim(traceStr);
 
   // parse maps (comma-separated)
   std::vector<std::string> maps;
@@ -832,24 +1245,136 @@ void GameEngine::executeTournament(const std::string& cmd) {
   std::cout << "\n";
 
   std::cout << "Number of Games per Map: " << numGames << "\n";
-  std::cout << "Max Turns per Game: " << maxTurns << "\n\n";
+  std::cout << "Max Turns per Game: " << maxTurns << "\n";
+  if (!checkpointStr.empty()) std::cout << "Checkpoint File: " << checkpointStr << "\n";
+
+  // parse export files (comma-separated); records stream to them as games finish
+  TournamentExporter exporter;
+  exporter.setPlayerColumns(strategies.size());
+  std::istringstream outputStream(outputStr);
+  std::string outputToken;
+  while (std::getline(outputStream, outputToken, ',')) {
+    trim(outputToken);
+    if (outputToken.empty()) continue;
+
+    if (exporter.addFile(outputToken)) std::cout << "Exporting Results To: " << outputToken << "\n";
+    else std::cout << "Warning: cannot export results to " << outputToken << "\n";
+  }
+
+  // trace the games as chrome trace events; the timers behind them must be compiled in
+  TraceObserver traceObserver;
+  const bool tracing = !traceStr.empty() && Profiler::isEnabled() && Tracer::start(traceStr);
+  if (tracing) {
+    attach(&traceObserver);
+    std::cout << "Tracing To: " << traceStr << "\n";
+  } else if (!traceStr.empty()) {
+    std::cout << "Warning: cannot trace to " << traceStr
+              << (Profiler::isEnabled() ? "" : " (profiling is compiled out)") << "\n";
+  }
+  std::cout << "\n";
 
   // execute tournament: play G games on each of M maps
   std::vector results(maps.size(), std::vector<std::string>(numGames));
 
+  // resume an earlier run of the same tournament: an empty cell has not been played yet
+  const bool checkpointing = !checkpointStr.empty();
+  const std::string gameCheckpoint = checkpointStr + ".game";
+  const std::string signature = mapsStr + "|" + playersStr + "|" + std::to_string(numGames) + "|" + std::to_string(maxTurns);
+  int inFlightCell = -1;
+  std::uint32_t baseSeed = std::random_device{}(); // game seeds are baseSeed + cell, so a resumed game keeps its seed
+  std::vector<std::uintmax_t> exportSizes;
+
+  if (checkpointing && readTournamentCheckpoint(checkpointStr, signature, results, baseSeed, inFlightCell, exportSizes)) {
+    std::cout << "Resuming tournament from checkpoint " << checkpointStr << "\n";
+    // rows exported after the last checkpoint belong to the game in flight, which is played again
+    if (!exporter.truncate(exportSizes)) std::cout << "Warning: export files differ from the checkpoint, rows may repeat\n";
+  }
+
+  // the timing and allocation summary covers this tournament only
+  Profiler::reset();
+  const AllocationCounters heapStart = AllocationTracker::current();
+  const std::int64_t savedPeak = AllocationTracker::beginPeak();
+
   for (size_t mapIdx = 0; mapIdx < maps.size(); ++mapIdx) {
     std::cout << "\n--- Playing games on map: " << maps[mapIdx] << " ---\n";
 
     for (int gameIdx = 0; gameIdx < numGames; ++gameIdx) {
-      std::cout << "\nGame " << (gameIdx + 1) << " on " << maps[mapIdx] << "...\n";
-      std::string winner = playTournamentGame(maps[mapIdx], strategies, maxTurns);
+      if (!results[mapIdx][gameIdx].empty()) {
+        std::cout << "\nGame " << (gameIdx + 1) << " on " << maps[mapIdx] << " already played: "
+                  << results[mapIdx][gameIdx] << "\n";
+        continue;
+      }
+
+      const int cell = static_cast<int>(mapIdx) * numGames + gameIdx;
+      const std::uint32_t seed = baseSeed + static_cast<std::uint32_t>(cell);
+      if (checkpointing) {
+        writeTournamentCheckpoint(checkpointStr, signature, results, baseSeed, cell, exporter.sizes());
+        setCheckpointFile(gameCheckpoint);
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+      std::string winner;
+      if (checkpointing && cell == inFlightCell && loadGame(gameCheckpoint)) {
+        std::cout << "\nResuming game " << (gameIdx + 1) << " on " << maps[mapIdx]
+                  << " from turn " << currentTurn << "...\n";
+        setAutomaticMode(true);
+        winner = mainGameLoop(maxTurns);
+        setAutomaticMode(false);
+      } else {
+        std::cout << "\nGame " << (gameIdx + 1) << " on " << maps[mapIdx] << "...\n";
+        winner = playTournamentGame(maps[mapIdx], strategies, maxTurns, seed);
+      }
+
       results[mapIdx][gameIdx] = winner;
       std::cout << "Result: " << winner << "\n";
+
+      if (!exporter.empty()) {
+        GameRecord record;
+        record.map = maps[mapIdx];
+        record.gameIndex = gameIdx + 1;
+        record.seed = seed;
+        record.winner = winner;
+        record.turnsPlayed = turnsPlayed;
+        record.wallTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        record.players = tournamentStandings(strategies);
+        exporter.write(record);
+      }
+
+      // the checkpoint records the files with this game's row on disk (its own row group for .col files):
+      // a crash before it truncates the row away on resume, a crash after it keeps the row and the result
+      if (checkpointing) {
+        fs::remove(gameCheckpoint);
+        writeTournamentCheckpoint(checkpointStr, signature, results, baseSeed, -1, exporter.sizes());
+      }
     }
   }
+  setCheckpointFile("");
+
+  if (tracing) {
+    for (const auto& play : players) { play->getOrders()->detach(&traceObserver); }
+    detach(&traceObserver);
+    if (Tracer::stop()) std::cout << "Trace written to " << traceStr << "\n";
+  }
 
   // log results
   logTournamentResults(maps, strategies, numGames, maxTurns, results);
+
+  // timing and allocation summary, for whichever instrumentation is compiled in
+  std::ostringstream summary;
+  if (Profiler::isEnabled()) { Profiler::report(summary); }
+  if (AllocationTracker::isEnabled()) {
+    const AllocationCounters heap = AllocationTracker::current();
+    const std::int64_t peak = AllocationTracker::endPeak(savedPeak) - heapStart.liveBytes;
+    summary << "\nTournament heap: " << (heap.allocations - heapStart.allocations) << " allocations, "
+            << (heap.bytes - heapStart.bytes) / 1024 << " KiB allocated, " << peak / 1024 << " KiB peak\n";
+  }
+
+  if (!summary.view().empty()) {
+    std::cout << summary.view();
+
+    std::ofstream logFile(GAMELOG_FILE, std::ios::app);
+    if (logFile.is_open()) { logFile << summary.view(); }
+  }
   std::cout << "\n=== TOURNAMENT COMPLETE ===\n";
 }
 
@@ -858,10 +1383,11 @@ void GameEngine::executeTournament(const std::string& cmd) {
  * @param mapPath path to the map file
  * @param strategies list of player strategy names
  * @param maxTurns maximum number of turns before declaring a draw
+ * @param seed seeds the territory distribution and the card/battle rolls, for reproducible games
  * @return winner's strategy name or "Draw"
  */
 std::string GameEngine::playTournamentGame(
-  const std::string& mapPath, const std::vector<std::string>& strategies, int maxTurns
+  const std::string& mapPath, const std::vector<std::string>& strategies, int maxTurns, std::uint32_t seed
 ) {
   // enable automatic mode for tournament
   setAutomaticMode(true);
@@ -886,10 +1412,17 @@ std::string GameEngine::playTournamentGame(
   }
 
   gameMap = std::move(loadedMap);
+  this->mapPath = mapFile.string();
+
+  // clear existing players, and whatever the last game on this thread left with the neutral player and truces
+  players.clear();
+  neutralPlayer.reset();
+  Order::resetNegotiations();
+  currentTurn = 1;
 
-  // clear existing players
-  for (auto* play : *players) { delete play; }
-  players->clear();
+  // initialize deck, before the players that hold on to it
+  deck = std::make_unique<Deck>();
+  rng.seed(seed);
 
   // create players with specified strategies
   for (size_t i = 0; i < strategies.size(); ++i) {
@@ -901,25 +1434,17 @@ std::string GameEngine::playTournamentGame(
       displayName[0] = std::toupper(displayName[0]);
     }
 
-    Player* player = new Player(displayName, nullptr);
+    auto player = std::make_unique<Player>(displayName, deck.get());
 
     // assign strategy based on name
-    if (strategyName == PLAYER_STRATEGIES::HUMAN) {
-      player->setStrategy(new HumanPlayerStrategy(player));
-    } else if (strategyName == PLAYER_STRATEGIES::AGGRESSIVE) {
-      player->setStrategy(new AggressivePlayerStrategy(player));
-    } else if (strategyName == PLAYER_STRATEGIES::BENEVOLENT) {
-      player->setStrategy(new BenevolentPlayerStrategy(player));
-    } else if (strategyName == PLAYER_STRATEGIES::NEUTRAL) {
-      player->setStrategy(new NeutralPlayerStrategy(player));
-    } else if (strategyName == PLAYER_STRATEGIES::CHEATER) {
-      player->setStrategy(new CheaterPlayerStrategy(player));
-    } else {
+    std::unique_ptr<PlayerStrategy> strategy = PlayerStrategy::create(strategyName, player.get());
+    if (!strategy) {
       std::cout << "Warning: Unknown strategy " << strategyName << ", using Neutral\n";
-      player->setStrategy(new NeutralPlayerStrategy(player));
+      strategy = std::make_unique<NeutralPlayerStrategy>(player.get());
     }
+    player->setStrategy(std::move(strategy));
 
-    players->push_back(player);
+    players.push_back(std::move(player));
   }
 
   // distribute territories
@@ -930,13 +1455,12 @@ std::string GameEngine::playTournamentGame(
     allTerritories.push_back(t.get());
   }
 
-  std::mt19937 rng(std::random_device{}());
   std::ranges::shuffle(allTerritories, rng);
 
   for (size_t i = 0; i < allTerritories.size(); ++i) {
     Territory* terr = allTerritories[i];
     Player* oldOwner = terr->getOwner();
-    Player* newOwner = (*players)[i % players->size()];
+    Player* newOwner = players[i % players.size()].get();
 
     if (oldOwner && oldOwner != newOwner) oldOwner->removeTerritory(terr);
     if (!newOwner->ownsTerritory(terr)) newOwner->addTerritory(terr);
@@ -946,12 +1470,8 @@ std::string GameEngine::playTournamentGame(
     terr->setArmies(3);
   }
 
-  // initialize deck
-  if (deck) { delete deck; }
-  deck = new Deck();
-
   // give each player initial armies
-  for (auto* play : *players) { play->setReinforcementPool(30); }
+  for (const auto& play : players) { play->setReinforcementPool(30); }
 
   // play the game using mainGameLoop with turn limit
   std::string winner = mainGameLoop(maxTurns);
@@ -960,6 +1480,33 @@ std::string GameEngine::playTournamentGame(
   return winner;
 }
 
+/**
+ * final standings of the last tournament game, one entry per strategy in lineup order
+ * @param strategies the lineup the game was played with
+ * @return territories and armies of each survivor, zeros for the eliminated
+ */
+std::vector<PlayerResult> GameEngine::tournamentStandings(const std::vector<std::string>& strategies) const {
+  std::vector<PlayerResult> standings;
+  if (!gameMap) return standings;
+
+  // survivors keep their creation order, so walk them alongside the strategies; the rest were eliminated
+  const MapTally tally = gameMap->tally(getPlayers());
+  std::size_t next = 0;
+  for (const auto& strategy : strategies) {
+    PlayerResult standing;
+    standing.name = strategy;
+    if (!standing.name.empty()) standing.name[0] = std::toupper(standing.name[0]);
+
+    if (next < players.size() && players[next]->getName() == standing.name) {
+      standing.territories = tally.players[next].territories;
+      standing.armies = tally.players[next].armies;
+      next++;
+    }
+    standings.push_back(standing);
+  }
+  return standings;
+}
+
 /**
  * log tournament results to console and file
  * @param maps list of map names
@@ -1065,17 +1612,99 @@ void GameEngine::logTournamentResults(
   }
 }
 
+/**
+ * write the tournament results matrix and the cell of the game in flight
+ * @param path checkpoint file
+ * @param signature maps, strategies, games and turns of the tournament, so another tournament never resumes from it
+ * @param results 2d vector of results [mapIndex][gameIndex], empty for games not played yet
+ * @param baseSeed seed the game seeds are derived from
+ * @param inFlightCell mapIndex * numGames + gameIndex of the game being played, or -1
+ * @param exportSizes size of each export file holding exactly the rows of the played games
+ * @return false if the file could not be written
+ */
+bool GameEngine::writeTournamentCheckpoint(
+  const std::string& path, const std::string& signature,
+  const std::vector<std::vector<std::string>>& results, std::uint32_t baseSeed, int inFlightCell,
+  const std::vector<std::uintmax_t>& exportSizes
+) {
+  std::string out;
+  out.append(TOURNAMENT_MAGIC, sizeof(TOURNAMENT_MAGIC));
+  putInt(out, TOURNAMENT_VERSION);
+  putString(out, signature);
+  putInt(out, static_cast<std::int32_t>(baseSeed));
+  putInt(out, inFlightCell);
+
+  putInt(out, static_cast<std::int32_t>(results.size()));
+  putInt(out, static_cast<std::int32_t>(results.empty() ? 0 : results.front().size()));
+  for (const auto& row : results) {
+    for (const auto& result : row) { putString(out, result); }
+  }
+
+  putInt(out, static_cast<std::int32_t>(exportSizes.size()));
+  for (const std::uintmax_t size : exportSizes) { putLong(out, static_cast<std::int64_t>(size)); }
+
+  return writeFileAtomically(path, out);
+}
+
+/**
+ * read a checkpoint written by writeTournamentCheckpoint for the same tournament
+ * @return false (leaving results untouched) if the file is missing, corrupt or from another tournament
+ */
+bool GameEngine::readTournamentCheckpoint(
+  const std::string& path, const std::string& signature,
+  std::vector<std::vector<std::string>>& results, std::uint32_t& baseSeed, int& inFlightCell,
+  std::vector<std::uintmax_t>& exportSizes
+) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+
+  const std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  SaveReader in{bytes};
+
+  if (!in.has(sizeof(TOURNAMENT_MAGIC)) || std::memcmp(bytes.data(), TOURNAMENT_MAGIC, sizeof(TOURNAMENT_MAGIC)) != 0) return false;
+  in.pos += sizeof(TOURNAMENT_MAGIC);
+  if (in.getInt() != TOURNAMENT_VERSION || in.getString() != signature) return false;
+
+  const auto seed = static_cast<std::uint32_t>(in.getInt());
+  const std::int32_t cell = in.getInt();
+  const std::int32_t mapCount = in.getInt();
+  const std::int32_t gameCount = in.getInt();
+  if (mapCount != static_cast<std::int32_t>(results.size())) return false;
+  if (gameCount != static_cast<std::int32_t>(results.empty() ? 0 : results.front().size())) return false;
+
+  std::vector<std::vector<std::string>> loaded(mapCount, std::vector<std::string>(gameCount));
+  for (auto& row : loaded) {
+    for (auto& result : row) { result = in.getString(); }
+  }
+
+  const std::int32_t exportCount = in.getInt();
+  if (exportCount < 0 || !in.has(exportCount * sizeof(std::int64_t))) return false;
+  std::vector<std::uintmax_t> sizes;
+  for (std::int32_t i = 0; i < exportCount; ++i) {
+    const std::int64_t size = in.getLong();
+    if (size < 0) return false;
+    sizes.push_back(static_cast<std::uintmax_t>(size));
+  }
+  if (!in.ok) return false;
+
+  results = std::move(loaded);
+  baseSeed = seed;
+  inFlightCell = cell;
+  exportSizes = std::move(sizes);
+  return true;
+}
+
 // --- UTILITY --
 std::string GameEngine::stringToLog() const {
   return "GameEngine state changed to: " + getCurrentStateName();
 }
 
 void GameEngine::displayValidCommands() const {
-  std::cout << "Valid commands for state '" << currentState->getName() << "': ";
-  std::vector<std::string> validCommands = currentState->getValidCommands();
+  std::cout << "Valid commands for state '" << GameStateMachine::nameOf(currentState) << "': ";
+  const std::vector<GameCommand> validCommands = GameStateMachine::validCommands(currentState);
 
   for (size_t i = 0; i < validCommands.size(); ++i) {
-    std::cout << validCommands[i];
+    std::cout << GameStateMachine::nameOf(validCommands[i]);
     if (i < validCommands.size() - 1) { std::cout << ", "; }
   }
   std::cout << std::endl;
@@ -1083,64 +1712,26 @@ void GameEngine::displayValidCommands() const {
 
 void GameEngine::displayStateHistory() const {
   std::cout << "State transition history: ";
-  for (size_t i = 0; i < stateHistory->size(); ++i) {
-    std::cout << (*stateHistory)[i];
-    if (i < stateHistory->size() - 1) { std::cout << " -> "; }
+  // journaled states first, then the ones still in memory
+  std::string separator;
+  const std::vector<std::string> journaled = stateHistory.readJournal();
+  if (journaled.size() < stateHistory.getEvicted()) {
+    std::cout << "(" << stateHistory.getEvicted() - journaled.size() << " earlier states dropped)";
+    separator = " -> ";
+  }
+
+  for (const std::string& name : journaled) {
+    std::cout << separator << name;
+    separator = " -> ";
   }
+  stateHistory.forEach([&separator](GameState state) {
+    std::cout << separator << GameStateMachine::nameOf(state);
+    separator = " -> ";
+  });
   std::cout << std::endl;
 }
 
 // --- HELPERS --
-void GameEngine::initializeStates() {
-  // create all states based on the assignment state diagram
-  (*states)[GAME_PHASES::STARTUP] = new State(GAME_PHASES::STARTUP);
-  (*states)[GAME_STATES::START] = new State(GAME_STATES::START);
-  (*states)[GAME_STATES::MAP_LOADED] = new State(GAME_STATES::MAP_LOADED);
-  (*states)[GAME_STATES::MAP_VALIDATED] = new State(GAME_STATES::MAP_VALIDATED);
-  (*states)[GAME_STATES::PLAYERS_ADDED] = new State(GAME_STATES::PLAYERS_ADDED);
-  (*states)[GAME_PHASES::PLAY] = new State(GAME_PHASES::PLAY);
-  (*states)[GAME_STATES::ASSIGN_REINFORCEMENT] = new State(GAME_STATES::ASSIGN_REINFORCEMENT);
-  (*states)[GAME_STATES::ISSUE_ORDERS] = new State(GAME_STATES::ISSUE_ORDERS);
-  (*states)[GAME_STATES::EXECUTE_ORDERS] = new State(GAME_STATES::EXECUTE_ORDERS);
-  (*states)[GAME_STATES::WIN] = new State(GAME_STATES::WIN);
-
-  // setup transitions based on the assignment state diagram
-  // from startup state (the initial state before start)
-  (*states)[GAME_PHASES::STARTUP]->addTransition(new Transition(GAME_STATES::START, GAME_STATES::START));
-
-  // from start state
-  (*states)[GAME_STATES::START]->addTransition(new Transition(GAME_TRANSITIONS::LOADMAP, GAME_STATES::MAP_LOADED));
-
-  // from map loaded state
-  (*states)[GAME_STATES::MAP_LOADED]->addTransition(new Transition(GAME_TRANSITIONS::LOADMAP, GAME_STATES::MAP_LOADED));
-  (*states)[GAME_STATES::MAP_LOADED]->addTransition(new Transition(GAME_TRANSITIONS::VALIDATEMAP, GAME_STATES::MAP_VALIDATED));
-
-  // from map validated state
-  (*states)[GAME_STATES::MAP_VALIDATED]->addTransition(new Transition(GAME_TRANSITIONS::ADDPLAYER, GAME_STATES::PLAYERS_ADDED));
-
-  // from players added state
-  (*states)[GAME_STATES::PLAYERS_ADDED]->addTransition(new Transition(GAME_TRANSITIONS::ADDPLAYER, GAME_STATES::PLAYERS_ADDED));
-  (*states)[GAME_STATES::PLAYERS_ADDED]->addTransition(new Transition(GAME_TRANSITIONS::GAMESTART, GAME_STATES::ASSIGN_REINFORCEMENT));
-
-  (*states)[GAME_PHASES::PLAY]->addTransition(new Transition(GAME_PHASES::PLAY, GAME_STATES::ASSIGN_REINFORCEMENT));
-  // from assign reinforcement state
-  (*states)[GAME_STATES::ASSIGN_REINFORCEMENT]->addTransition(new Transition(GAME_TRANSITIONS::ISSUEORDER, GAME_STATES::ISSUE_ORDERS));
-
-  // from issue orders state
-  (*states)[GAME_STATES::ISSUE_ORDERS]->addTransition(new Transition(GAME_TRANSITIONS::ISSUEORDER, GAME_STATES::ISSUE_ORDERS));
-  (*states)[GAME_STATES::ISSUE_ORDERS]->addTransition(new Transition(GAME_TRANSITIONS::ENDISSUEORDERS, GAME_STATES::EXECUTE_ORDERS));
-
-  // from execute orders state
-  (*states)[GAME_STATES::EXECUTE_ORDERS]->addTransition(new Transition(GAME_TRANSITIONS::EXECORDER, GAME_STATES::EXECUTE_ORDERS));
-  (*states)[GAME_STATES::EXECUTE_ORDERS]->addTransition(new Transition(GAME_TRANSITIONS::ENDEXECORDERS, GAME_STATES::ASSIGN_REINFORCEMENT));
-  (*states)[GAME_STATES::EXECUTE_ORDERS]->addTransition(new Transition(GAME_STATES::WIN, GAME_STATES::WIN));
-
-  // from win state
-  (*states)[GAME_STATES::WIN]->addTransition(new Transition(GAME_TRANSITIONS::REPLAY, GAME_STATES::START));
-  (*states)[GAME_STATES::WIN]->addTransition(new Transition(GAME_TRANSITIONS::QUIT, GAME_STATES::WIN));
-  // stays in win, but signals exit
-}
-
 void GameEngine::processCommand(const std::string& cmd) {
   // parse the base command
   std::string baseCmd = cmd;
@@ -1150,33 +1741,23 @@ void GameEngine::processCommand(const std::string& cmd) {
   }
 
   // look for transition using base command
-  Transition* transition = currentState->getTransition(baseCmd);
+  const std::optional<GameCommand> command = GameStateMachine::parseCommand(baseCmd);
+  const std::optional<GameState> target = command ? GameStateMachine::next(currentState, *command) : std::nullopt;
 
-  if (transition == nullptr) displayValidCommands();
+  if (!target) displayValidCommands();
   else {
     std::cout << "Executing command: " << cmd << std::endl;
-    transitionState(transition->getTargetState());
+    transitionState(*target);
   }
 }
 
-void GameEngine::transitionState(const std::string& stateName) {
-  auto it = states->find(stateName);
-  if (it == states->end()) {
-    std::cout << "Error: State '" << stateName << "' does not exist!" << std::endl;
-    return;
-  }
-
-  currentState = it->second;
-  stateHistory->push_back(stateName);
-  std::cout << "Transitioned to state: " << stateName << std::endl;
+void GameEngine::transitionState(GameState state) {
+  currentState = state;
+  stateHistory.push(state);
+  std::cout << "Transitioned to state: " << GameStateMachine::nameOf(state) << std::endl;
   notify();
 }
 
-void GameEngine::cleanupStates() {
-  for (auto& snd : *states | std::views::values) { delete snd; }
-  states->clear();
-}
-
 std::string GameEngine::trimCopy(const std::string& inp) {
   auto begin = std::ranges::find_if_not(inp, [](int c) { return std::isspace(c); });
   auto end = std::find_if_not(inp.rbegin(), inp.rend(), [](int c) { return std::isspace(c); }).base();
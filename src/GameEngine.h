@@ -1,75 +1,152 @@
 #pragma once
+#include "Cards.h"
+#include "History.h"
 #include "LoggingObserver.h"
 #include "Map.h"
 #include "Player.h"
 
-#include <map>
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <random>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
-class Transition;
 class CommandProcessor;
-class Deck;
+struct PlayerResult;
+
+/*
+States and commands of the game's state diagram. Names are only used for display, logging and save files.
+*/
+enum class GameState : std::uint8_t {
+  STARTUP, START, MAP_LOADED, MAP_VALIDATED, PLAYERS_ADDED,
+  PLAY, ASSIGN_REINFORCEMENT, ISSUE_ORDERS, EXECUTE_ORDERS, WIN
+};
 
-class State {
-private:
-  std::string* name;
-  std::vector<Transition*>* transitions;
+enum class GameCommand : std::uint8_t {
+  START, LOADMAP, VALIDATEMAP, ADDPLAYER, GAMESTART, PLAY,
+  ISSUEORDER, ENDISSUEORDERS, EXECORDER, ENDEXECORDERS, WIN, REPLAY, QUIT
+};
 
-public:
-  State();
-  State(const std::string& newName);
-  State(const State& other); // copy constructor
-  State& operator=(const State& other); // assignment operator
-  ~State(); // destructor
+constexpr int GAME_STATE_COUNT = 10;
+constexpr int GAME_COMMAND_COUNT = 13;
 
-  // getters
-  std::string getName() const;
-  Transition* getTransition(const std::string& cmd) const;
 
-  // transition management
-  void addTransition(Transition* transition);
+/*
+The state diagram as a table built at compile time: one row per state, one column per command.
+A transition is a single indexed load; NO_TRANSITION marks commands that are invalid in a state.
+*/
+class GameStateMachine {
+public:
+  static constexpr std::uint8_t NO_TRANSITION = 0xFF;
 
-  // utility
-  std::vector<std::string> getValidCommands() const;
+private:
+  struct Edge {
+    GameState from;
+    GameCommand command;
+    GameState to;
+  };
+
+  static constexpr Edge EDGES[] = {
+    {GameState::STARTUP, GameCommand::START, GameState::START},
+    {GameState::START, GameCommand::LOADMAP, GameState::MAP_LOADED},
+    {GameState::MAP_LOADED, GameCommand::LOADMAP, GameState::MAP_LOADED},
+    {GameState::MAP_LOADED, GameCommand::VALIDATEMAP, GameState::MAP_VALIDATED},
+    {GameState::MAP_VALIDATED, GameCommand::ADDPLAYER, GameState::PLAYERS_ADDED},
+    {GameState::PLAYERS_ADDED, GameCommand::ADDPLAYER, GameState::PLAYERS_ADDED},
+    {GameState::PLAYERS_ADDED, GameCommand::GAMESTART, GameState::ASSIGN_REINFORCEMENT},
+    {GameState::PLAY, GameCommand::PLAY, GameState::ASSIGN_REINFORCEMENT},
+    {GameState::ASSIGN_REINFORCEMENT, GameCommand::ISSUEORDER, GameState::ISSUE_ORDERS},
+    {GameState::ISSUE_ORDERS, GameCommand::ISSUEORDER, GameState::ISSUE_ORDERS},
+    {GameState::ISSUE_ORDERS, GameCommand::ENDISSUEORDERS, GameState::EXECUTE_ORDERS},
+    {GameState::EXECUTE_ORDERS, GameCommand::EXECORDER, GameState::EXECUTE_ORDERS},
+    {GameState::EXECUTE_ORDERS, GameCommand::ENDEXECORDERS, GameState::ASSIGN_REINFORCEMENT},
+    {GameState::EXECUTE_ORDERS, GameCommand::WIN, GameState::WIN},
+    {GameState::WIN, GameCommand::REPLAY, GameState::START},
+    {GameState::WIN, GameCommand::QUIT, GameState::WIN}, // stays in win, but signals exit
+  };
+
+  using Table = std::array<std::array<std::uint8_t, GAME_COMMAND_COUNT>, GAME_STATE_COUNT>;
+
+  static constexpr Table buildTable() {
+    Table table{};
+    for (auto& row : table) row.fill(NO_TRANSITION);
+    for (const Edge& edge : EDGES) {
+      table[static_cast<int>(edge.from)][static_cast<int>(edge.command)] = static_cast<std::uint8_t>(edge.to);
+    }
+    return table;
+  }
+
+  static const Table TABLE; // defined below, once buildTable() is complete
 
-  // stream insertion operator
-  friend std::ostream& operator<<(std::ostream& os, const State& st);
+public:
+  // queries
+  static constexpr std::optional<GameState> next(GameState state, GameCommand command) {
+    const std::uint8_t to = TABLE[static_cast<int>(state)][static_cast<int>(command)];
+    if (to == NO_TRANSITION) return std::nullopt;
+    return static_cast<GameState>(to);
+  }
+
+  static std::vector<GameCommand> validCommands(GameState state);
+
+  // names
+  static std::string_view nameOf(GameState state);
+  static std::string_view nameOf(GameCommand command);
+  static std::optional<GameState> parseState(std::string_view name);
+  static std::optional<GameCommand> parseCommand(std::string_view name);
 };
 
+inline constexpr GameStateMachine::Table GameStateMachine::TABLE = GameStateMachine::buildTable();
+
+static_assert(GameStateMachine::next(GameState::EXECUTE_ORDERS, GameCommand::ENDEXECORDERS) == GameState::ASSIGN_REINFORCEMENT);
+static_assert(!GameStateMachine::next(GameState::START, GameCommand::VALIDATEMAP));
 
-class Transition {
+
+/*
+Live standings of the game in progress, kept current by ownership changes on the game map.
+Eliminations and the end of the game are known the moment the deciding territory changes hands.
+*/
+class GameStandings : public OwnershipListener {
 private:
-  std::string* command;
-  std::string* targetState;
+  std::vector<Player*> active;     // players still holding territory, the neutral player never counts
+  std::vector<Player*> eliminated; // in order of elimination, not yet removed from the game
+  bool running = false;
 
 public:
-  Transition();
-  Transition(const std::string& cmd, const std::string& targSts);
-  Transition(const Transition& other); // copy constructor
-  Transition& operator=(const Transition& other); // assignment operator
-  ~Transition(); // destructor
-
   // getters
-  std::string getCommand() const;
-  std::string getTargetState() const;
-
-  // stream insertion operator
-  friend std::ostream& operator<<(std::ostream& os, const Transition& tran);
+  int getActivePlayers() const;
+  bool isDecided() const; // at most one player left in a running game
+
+  // management
+  void start(std::span<Player* const> players);
+  void stop();
+  void ownerChanged(Territory* terr, Player* oldOwner) override;
+  std::vector<Player*> takeEliminated(); // hands over the eliminations since the last call
 };
 
 
 class GameEngine : public Subject, public ILoggable {
+public:
+  static constexpr std::size_t STATE_HISTORY_CAPACITY = 256;
+
 private:
-  State* currentState;
-  std::map<std::string, State*>* states;
-  std::vector<std::string>* stateHistory;
-  std::unique_ptr<Map> gameMap;           //  add: holds the loaded/validated map
-  std::vector<Player*>* players;           // players created by addplayer
-  Deck* deck;
-  static Player* neutralPlayer;
-  static bool automaticMode;              // flag to indicate if game is in automatic/tournament mode
+  GameState currentState;
+  BoundedHistory<GameState> stateHistory;       // most recent states, older ones go to the journal if one is set
+  std::unique_ptr<Map> gameMap;                 // holds the loaded/validated map
+  std::vector<std::unique_ptr<Player>> players; // players created by addplayer
+  std::unique_ptr<Deck> deck;
+  std::string mapPath;                          // file the current map was loaded from, recorded in save files
+  int currentTurn;                              // turn the main game loop is on (or resumes from after a load)
+  std::string checkpointPath;                   // if set, the main game loop saves the game here after every turn
+  int turnsPlayed;                              // length of the last finished game
+  GameStandings standings;                      // attached to the map while the main game loop runs
+  std::mt19937 rng;                             // every random choice of the game, bound for the game's thread while it plays
+  static thread_local std::unique_ptr<Player> neutralPlayer; // per thread, as a game runs on a single thread
+  static thread_local bool automaticMode;                    // flag to indicate if game is in automatic/tournament mode
+  static thread_local const std::vector<std::unique_ptr<Player>>* roster; // players of the game playing on this thread
 
 public:
   GameEngine();
@@ -78,18 +155,26 @@ public:
   ~GameEngine() override; // destructor
 
   // getters
+  GameState getCurrentState() const;
   std::string getCurrentStateName() const;
-  const std::vector<Player*>& getPlayers() const;
+  std::vector<Player*> getPlayers() const; // non-owning view, in play order
+  Map* getMap() const;
+  Deck* getDeck() const;
+  int getCurrentTurn() const;
+  int getTurnsPlayed() const;
   static Player* getNeutralPlayer();
   static bool getAutomaticMode();
+  static std::span<const std::unique_ptr<Player>> getRoster(); // empty outside a game's main loop
 
   // setters
   void setMap(Map* map);
-  void setDeck(Deck* newDeck);
+  void setDeck(std::unique_ptr<Deck> newDeck);
+  void setCheckpointFile(const std::string& path);
+  bool setStateJournal(const std::string& path); // evicted states are appended here, empty path drops them
   static void setAutomaticMode(bool mode);
 
   // player management
-  void addPlayer(Player* player);
+  void addPlayer(std::unique_ptr<Player> player);
 
   // startup phase management
   void startupPhase();
@@ -103,9 +188,16 @@ public:
   // main game loop management
   std::string mainGameLoop(int maxTurns);
 
+  // save and load
+  bool saveGame(const std::string& path) const;
+  bool loadGame(const std::string& path);
+
   // tournament mode management
   void executeTournament(const std::string& cmd);
-  std::string playTournamentGame(const std::string& mapPath, const std::vector<std::string>& strategies, int maxTurns);
+  std::string playTournamentGame(
+    const std::string& mapPath, const std::vector<std::string>& strategies, int maxTurns, std::uint32_t seed
+  );
+  std::vector<PlayerResult> tournamentStandings(const std::vector<std::string>& strategies) const;
 
   static void logTournamentResults(
     const std::vector<std::string>& maps, const std::vector<std::string>& strategies,
@@ -119,15 +211,23 @@ public:
 
   // helpers
   void processCommand(const std::string& cmd);
-  void transitionState(const std::string& stateName);
+  void transitionState(GameState state);
 
   // stream insertion operator
   friend std::ostream& operator<<(std::ostream& os, const GameEngine& engine);
 
 private:
   // helpers
-  void initializeStates();
-  void cleanupStates();
+  static bool writeTournamentCheckpoint(
+    const std::string& path, const std::string& signature,
+    const std::vector<std::vector<std::string>>& results, std::uint32_t baseSeed, int inFlightCell,
+    const std::vector<std::uintmax_t>& exportSizes
+  );
+  static bool readTournamentCheckpoint(
+    const std::string& path, const std::string& signature,
+    std::vector<std::vector<std::string>>& results, std::uint32_t& baseSeed, int& inFlightCell,
+    std::vector<std::uintmax_t>& exportSizes
+  );
   static std::string trimCopy(const std::string& inp);
 };
 
@@ -159,6 +259,8 @@ namespace GAME_TRANSITIONS {
   constexpr auto ENDEXECORDERS = "endexecorders";
   constexpr auto REPLAY = "replay";
   constexpr auto QUIT = "quit";
+  constexpr auto SAVEGAME = "savegame";
+  constexpr auto LOADGAME = "loadgame";
 }
 
 // free function
@@ -166,3 +268,7 @@ void testGameStates();
 void testStartupPhase();
 void testMainGameLoop();
 void testTournament();
+void testTournamentCheckpoint();
+void testTournamentExport();
+void testSaveLoad();
+void testEarlyGameEnd();
@@ -1,10 +1,19 @@
 #include "Cards.h"
+#include "CommandProcessing.h"
 #include "GameEngine.h"
+#include "Input.h"
+#include "GameSnapshot.h"
 #include "Map.h"
 #include "Orders.h"
 #include "Player.h"
+#include "PlayerStrategies.h"
+#include "Utility.h"
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -28,7 +37,7 @@ void testGameStates() {
 
   while (true) {
     std::cout << "\nEnter command: ";
-    std::getline(std::cin, input);
+    input = Input::readLine();
 
     // handle special commands
     if (input == "quit") {
@@ -153,9 +162,9 @@ void testAutomaticMainGameLoop() {
   t6->setArmies(1);
 
   // create deck and give players some cards
-  player1->addCard(deck->draw());
-  player1->addCard(deck->draw());
-  player2->addCard(deck->draw());
+  if (const auto card = deck->draw(GameRandom::get())) player1->addCard(*card);
+  if (const auto card = deck->draw(GameRandom::get())) player1->addCard(*card);
+  if (const auto card = deck->draw(GameRandom::get())) player2->addCard(*card);
 
   std::cout << "=== TEST SETUP COMPLETE ===\n";
   std::cout << "Map: " << testMap->getName() << "\n";
@@ -204,11 +213,11 @@ void testAutomaticMainGameLoop() {
 
   std::cout << "Alice issued a deploy order\n";
   std::cout << "  Remaining reinforcements: " << player1->getReinforcementPool() << "\n";
-  std::cout << "  Orders in list: " << player1->getOrders()->orders->size() << "\n";
+  std::cout << "  Orders in list: " << player1->getOrders()->orders.size() << "\n";
 
   // check that it's actually a deploy-order
-  if (player1->getOrders()->orders->size() > 0) {
-    Order* order = player1->getOrders()->orders->at(0);
+  if (player1->getOrders()->orders.size() > 0) {
+    Order* order = player1->getOrders()->orders.front().get();
     OrderDeploy* deployOrder = dynamic_cast<OrderDeploy*>(order);
 
     if (deployOrder) std::cout << "Order is confirmed to be a Deploy order\n";
@@ -224,11 +233,11 @@ void testAutomaticMainGameLoop() {
   std::cout << "Calling issueOrder()...\n";
 
   std::cout << "Bob issued an advance order (since no reinforcements left)\n";
-  std::cout << "  Orders in list: " << player2->getOrders()->orders->size() << "\n";
+  std::cout << "  Orders in list: " << player2->getOrders()->orders.size() << "\n";
 
   // check that it's an advance order
-  if (player2->getOrders()->orders->size() > 0) {
-    Order* order = player2->getOrders()->orders->at(0);
+  if (player2->getOrders()->orders.size() > 0) {
+    Order* order = player2->getOrders()->orders.front().get();
     OrderAdvance* advanceOrder = dynamic_cast<OrderAdvance*>(order);
 
     if (advanceOrder) std::cout << "Order is confirmed to be an Advance order\n";
@@ -371,3 +380,127 @@ void testInvalidCommands() {
 
   std::cout << "\n=== End of Invalid Commands Test ===" << std::endl;
 }
+
+/**
+ * Test savegame/loadgame:
+ *   1. a started game is saved from the startup command set and loaded into a fresh engine
+ *   2. the loaded game matches the saved one (state, turn, players, snapshot of the board)
+ *   3. the loaded game can be played on from the saved position
+ */
+void testSaveLoad() {
+  std::cout << "\n=== Testing Save/Load ===" << std::endl;
+  const std::filesystem::path dir = std::filesystem::temp_directory_path();
+  const std::string commandsFile = (dir / "risk_saveload_commands.txt").string();
+  const std::string saveFile = (dir / "risk_saveload.sav").string();
+
+  // 1. start a game through the startup phase and save it with the savegame command
+  {
+    std::ofstream commands(commandsFile);
+    commands << "start\n"
+             << "loadmap Canada/Canada.map\n"
+             << "validatemap\n"
+             << "addplayer Alice\n"
+             << "addplayer Bob\n"
+             << "addplayer Carol\n"
+             << "gamestart\n";
+  }
+
+  GameEngine original;
+  FileCommandProcessorAdapter startup(commandsFile);
+  original.startupPhase(startup);
+
+  CommandProcessor validator;
+  std::cout << "\n1. 'savegame' valid in state '" << original.getCurrentStateName() << "': "
+            << (validator.validate("savegame " + saveFile, &original) ? "yes" : "no") << std::endl;
+  const bool saved = original.saveGame(saveFile);
+  std::cout << "Saved to " << saveFile << ": " << (saved ? "yes" : "no") << " ("
+            << std::filesystem::file_size(saveFile) << " bytes)" << std::endl;
+
+  // 2. load it into a fresh engine and compare
+  GameEngine loaded;
+  const auto start = std::chrono::steady_clock::now();
+  const bool ok = loaded.loadGame(saveFile);
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start
+  ).count();
+
+  GameSnapshot before, after;
+  before.capture(original);
+  after.capture(loaded);
+
+  std::cout << "\n2. Loaded: " << (ok ? "yes" : "no") << " in " << elapsed << " us" << std::endl;
+  std::cout << "State: " << loaded.getCurrentStateName() << ", turn " << loaded.getCurrentTurn() << std::endl;
+  for (const Player* play : loaded.getPlayers()) {
+    std::cout << " - " << play->getName() << " (" << *play->getPlayerStrategy()->getStrategy() << "): "
+              << play->getTerritoryCount() << " territories, " << play->getHand()->size() << " cards" << std::endl;
+  }
+  std::cout << "Board matches the saved game: " << (before == after ? "yes" : "no") << std::endl;
+  std::cout << "Corrupt file rejected: " << (loaded.loadGame(commandsFile) ? "no" : "yes") << std::endl;
+
+  // 3. keep playing from the saved position
+  std::cout << "\n3. Playing on from the loaded game:" << std::endl;
+  // the strategies pick their territories without prompting, as a resumed tournament game does
+  GameEngine::setAutomaticMode(true);
+  std::cout << "Result after 10 turns: " << loaded.mainGameLoop(10) << std::endl;
+  GameEngine::setAutomaticMode(false);
+
+  std::filesystem::remove(commandsFile);
+  std::filesystem::remove(saveFile);
+}
+
+/**
+ * Test that a game ends the moment it is decided:
+ *   1. a cheater next to every territory of its only rival takes them all with the first order of the batch
+ *   2. the rival's orders queued behind it are dropped, and the game is won on its first turn
+ */
+void testEarlyGameEnd() {
+  std::cout << "\n=== Testing Early Game End ===" << std::endl;
+
+  // Alice's one territory borders both of Bob's
+  Map board("Early End");
+  Continent* continent = board.addContinent("Middle", 1, 2);
+  Territory* keep = board.addTerritory("Keep", 1);
+  Territory* east = board.addTerritory("East", 2);
+  Territory* west = board.addTerritory("West", 3);
+  for (Territory* terr : {keep, east, west}) continent->addTerritory(terr);
+  Map::addAdjacency(keep, east);
+  Map::addAdjacency(keep, west);
+  Map::addAdjacency(east, west);
+
+  GameEngine engine;
+  engine.setMap(&board);
+  engine.setDeck(std::make_unique<Deck>());
+  Map* map = engine.getMap();
+
+  auto alice = std::make_unique<Player>("Alice", engine.getDeck());
+  alice->setStrategy(std::make_unique<CheaterPlayerStrategy>(alice.get()));
+  auto bob = std::make_unique<Player>("Bob", engine.getDeck());
+  bob->setStrategy(std::make_unique<BenevolentPlayerStrategy>(bob.get()));
+
+  alice->addTerritory(map->getTerritory("Keep"));
+  bob->addTerritory(map->getTerritory("East"));
+  bob->addTerritory(map->getTerritory("West"));
+  map->getTerritory("Keep")->setArmies(5);
+  map->getTerritory("East")->setArmies(8);
+  map->getTerritory("West")->setArmies(1);
+  engine.addPlayer(std::move(alice));
+  engine.addPlayer(std::move(bob));
+
+  // the game's own report of the orders it dropped is the evidence, so keep what it prints
+  std::ostringstream played;
+  std::streambuf* console = std::cout.rdbuf(played.rdbuf());
+  GameEngine::setAutomaticMode(true);
+  const std::string winner = engine.mainGameLoop(5);
+  GameEngine::setAutomaticMode(false);
+  std::cout.rdbuf(console);
+
+  const std::string log = played.str();
+  const std::size_t decided = log.find("The game has been decided, ");
+  const int dropped = decided == std::string::npos ? 0 : std::stoi(log.substr(decided + 27));
+
+  std::cout << "1. Winner: " << winner << " after " << engine.getTurnsPlayed() << " turn(s), state "
+            << engine.getCurrentStateName() << std::endl;
+  std::cout << "2. Orders dropped once the game was decided: " << dropped << std::endl;
+  std::cout << "   Ended mid-execution: "
+            << (winner == "Alice" && engine.getTurnsPlayed() == 1 && dropped > 0 ? "YES" : "NO") << std::endl;
+}
@@ -0,0 +1,460 @@
+#include "GameServer.h"
+#include "CommandProcessing.h"
+#include "GameEngine.h"
+#include "LoggingObserver.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <iostream>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// ==================== GameServer Class Implementation ====================
+/*
+One client connection and the game it drives. The socket closes when the last owner lets go, so a worker
+still finishing a game never writes to a descriptor the event loop has already reused.
+*/
+struct GameServer::Session {
+  int id;
+  int fd;
+  InputQueue input;
+  std::string partial; // bytes after the last complete line, event loop only
+  std::mutex writeMutex;
+
+  // idle tracking: the clock only runs while the session's game is waiting on the client
+  std::atomic<bool> awaitingClient = false;
+  std::atomic<std::chrono::steady_clock::rep> lastActive = 0; // steady clock ticks of the last line either way
+
+  Session(int id, int fd) : id(id), fd(fd) {}
+  ~Session();
+
+  void reply(const std::string& line);
+  void touch();
+};
+
+#if defined(__linux__)
+namespace {
+  // the socket is non-blocking for the event loop, so a slow reader is waited on here, a second at a time
+  bool sendAll(int fd, const std::string& data) {
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+      const ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      if (n > 0) {
+        sent += static_cast<std::size_t>(n);
+      } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        pollfd out{fd, POLLOUT, 0};
+        if (::poll(&out, 1, 1000) <= 0) return false;
+      } else if (n < 0 && errno != EINTR) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool socketAddress(const std::string& path, sockaddr_un& addr) {
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) return false;
+    addr = {};
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+  }
+
+  // answers each command of a session with its effect, the moment the engine records it
+  class ReplyObserver : public Observer {
+  private:
+    std::function<void(const std::string&)> send;
+    int replies = 0;
+
+  public:
+    explicit ReplyObserver(std::function<void(const std::string&)> send) : send(std::move(send)) {}
+
+    int getReplies() const { return replies; }
+
+    void update(Subject* subject) override {
+      const auto* cmd = dynamic_cast<Command*>(subject);
+      if (!cmd) return;
+
+      replies++;
+      send(cmd->getEffect());
+    }
+  };
+}
+
+GameServer::Session::~Session() {
+  ::close(fd);
+}
+
+void GameServer::Session::reply(const std::string& line) {
+  touch();
+  std::lock_guard<std::mutex> lock(writeMutex);
+  sendAll(fd, line + "\n");
+}
+
+void GameServer::Session::touch() {
+  lastActive = std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+GameServer::GameServer(std::string socketPath, int workers, int maxTurns) :
+  socketPath(std::move(socketPath)),
+  workerCount(workers > 0 ? workers : Parallelism::available()),
+  maxTurns(maxTurns) {}
+
+GameServer::~GameServer() {
+  if (epollFd >= 0) ::close(epollFd);
+  if (wakeFd >= 0) ::close(wakeFd);
+  if (listenFd >= 0) {
+    ::close(listenFd);
+    ::unlink(socketPath.c_str());
+  }
+}
+
+// --- GETTERS ---
+const std::string& GameServer::getSocketPath() const {
+  return socketPath;
+}
+
+std::vector<ServedGame> GameServer::getServed() {
+  std::lock_guard<std::mutex> lock(poolMutex);
+  return served;
+}
+
+// --- SETTERS ---
+void GameServer::setIdleTimeout(std::chrono::milliseconds timeout) {
+  idleTimeout = timeout;
+}
+
+// --- MANAGEMENT ---
+bool GameServer::open() {
+  sockaddr_un addr;
+  if (listenFd >= 0 || !socketAddress(socketPath, addr)) return false;
+
+  // a socket file left behind by an earlier server would make bind fail
+  ::unlink(socketPath.c_str());
+
+  listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+  wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (listenFd < 0 || epollFd < 0 || wakeFd < 0) return false;
+
+  if (::bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || ::listen(listenFd, SOMAXCONN) < 0) {
+    ::close(listenFd);
+    listenFd = -1;
+    return false;
+  }
+
+  for (const int fd : {listenFd, wakeFd}) {
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+  }
+  return true;
+}
+
+void GameServer::run() {
+  if (listenFd < 0) return;
+
+  const Console::FilterScope filtered;
+  const Console::MuteScope quiet;
+  for (int t = 0; t < workerCount; t++) workers.emplace_back(&GameServer::work, this);
+
+  // idle sessions are looked for a few times per timeout, at most once a second
+  const auto idleCheckEvery = std::clamp(idleTimeout / 4, std::chrono::milliseconds(1), std::chrono::milliseconds(1000));
+  nextIdleCheck = std::chrono::steady_clock::now() + idleCheckEvery;
+
+  epoll_event events[64];
+  while (!stopping) {
+    const int ready = ::epoll_wait(epollFd, events, 64, static_cast<int>(idleCheckEvery.count()));
+    if (ready < 0 && errno != EINTR) break;
+
+    for (int i = 0; i < ready; i++) {
+      const int fd = events[i].data.fd;
+      if (fd == wakeFd) {
+        std::uint64_t count;
+        while (::read(wakeFd, &count, sizeof(count)) > 0) {}
+      } else if (fd == listenFd) {
+        acceptClients();
+      } else if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+        receive(fd);
+      }
+    }
+
+    if (std::chrono::steady_clock::now() >= nextIdleCheck) {
+      dropIdle();
+      nextIdleCheck = std::chrono::steady_clock::now() + idleCheckEvery;
+    }
+  }
+
+  // no new input: games still waiting on their clients read the end of their queue and finish
+  for (const auto& [fd, session] : sessions) {
+    ::epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    session->input.close();
+  }
+  sessions.clear();
+
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    stopping = true;
+  }
+  poolReady.notify_all();
+  for (auto& worker : workers) worker.join();
+  workers.clear();
+}
+
+void GameServer::stop() {
+  stopping = true;
+  const std::uint64_t one = 1;
+  if (wakeFd >= 0 && ::write(wakeFd, &one, sizeof(one)) < 0) return; // the counter is already set, the loop is awake
+}
+
+// --- EVENT LOOP ---
+void GameServer::acceptClients() {
+  while (true) {
+    const int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) return; // drained, or out of descriptors until a client leaves
+
+    auto session = std::make_shared<Session>(nextSession++, fd);
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.fd = fd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+    sessions.emplace(fd, session);
+
+    session->reply("session " + std::to_string(session->id));
+    {
+      std::lock_guard<std::mutex> lock(poolMutex);
+      waiting.push_back(std::move(session));
+    }
+    poolReady.notify_one();
+  }
+}
+
+void GameServer::receive(int fd) {
+  const auto it = sessions.find(fd);
+  if (it == sessions.end()) return;
+  Session& session = *it->second;
+
+  char buffer[4096];
+  while (true) {
+    const ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+    const int error = n < 0 ? errno : 0;
+    if (n > 0) {
+      session.touch();
+      session.partial.append(buffer, static_cast<std::size_t>(n));
+
+      // complete lines go to the game as they arrive, a trailing partial line waits for the rest
+      std::size_t start = 0;
+      for (std::size_t end; (end = session.partial.find('\n', start)) != std::string::npos; start = end + 1) {
+        if (end - start > MAX_LINE_LENGTH) break;
+        session.input.push(session.partial.substr(start, end - start));
+      }
+      session.partial.erase(0, start);
+
+      // whatever is left starts with an overlong line, finished or not
+      if (session.partial.size() > MAX_LINE_LENGTH) {
+        refuse(fd, "error line longer than " + std::to_string(MAX_LINE_LENGTH) + " bytes");
+        return;
+      }
+      continue;
+    }
+    if (error == EINTR) continue;
+
+    if (error == EAGAIN || error == EWOULDBLOCK) return;
+
+    // the client closed its end (or the socket failed): a last unterminated line still counts
+    if (!session.partial.empty()) session.input.push(std::move(session.partial));
+    hangUp(fd);
+    return;
+  }
+}
+
+void GameServer::hangUp(int fd) {
+  const auto it = sessions.find(fd);
+  if (it == sessions.end()) return;
+
+  ::epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+  it->second->input.close();
+  sessions.erase(it); // the worker playing the session, if any, keeps it alive until the game is over
+}
+
+void GameServer::refuse(int fd, const std::string& reason) {
+  const auto it = sessions.find(fd);
+  if (it == sessions.end()) return;
+
+  it->second->reply(reason);
+  ::shutdown(fd, SHUT_RD); // whatever else the client sends is dropped
+  hangUp(fd);
+}
+
+void GameServer::dropIdle() {
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  const auto limit = std::chrono::duration_cast<std::chrono::steady_clock::duration>(idleTimeout).count();
+
+  std::vector<int> idle;
+  for (const auto& [fd, session] : sessions) {
+    if (session->awaitingClient && now.count() - session->lastActive > limit) idle.push_back(fd);
+  }
+  for (const int fd : idle) refuse(fd, "error idle for more than " + std::to_string(idleTimeout.count()) + " ms");
+}
+
+// --- WORKER POOL ---
+void GameServer::work() {
+  const Parallelism::PoolScope pooled;
+  const Console::MuteScope quiet;
+  while (true) {
+    std::shared_ptr<Session> session;
+    {
+      std::unique_lock<std::mutex> lock(poolMutex);
+      poolReady.wait(lock, [this] { return !waiting.empty() || stopping; });
+      if (waiting.empty()) return;
+
+      session = std::move(waiting.front());
+      waiting.pop_front();
+    }
+
+    ServedGame game = play(*session);
+    ::shutdown(session->fd, SHUT_WR); // the client reads the end of the conversation
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    served.push_back(std::move(game));
+  }
+}
+
+ServedGame GameServer::play(Session& session) {
+  ServedGame game;
+  game.session = session.id;
+
+  // every prompt of this game, commands and choices alike, now reads from the session
+  Input::use(&session.input);
+  GameEngine::setAutomaticMode(false);
+  session.touch(); // time spent queued for a worker is not the client's
+  session.awaitingClient = true;
+
+  GameEngine engine;
+  CommandProcessor processor;
+  ReplyObserver replies([&session](const std::string& line) { session.reply(line); });
+  processor.attach(&replies);
+
+  engine.startupPhase(processor);
+  session.awaitingClient = false;
+  game.replies = replies.getReplies();
+
+  if (engine.getCurrentState() == GameState::PLAY) {
+    // strategies were dealt by addplayer; card targets are picked automatically so the game never stalls on one
+    GameEngine::setAutomaticMode(true);
+    game.started = true;
+    game.winner = engine.mainGameLoop(maxTurns);
+    game.turns = engine.getTurnsPlayed();
+    session.reply("result " + game.winner + " " + std::to_string(game.turns));
+  }
+
+  GameEngine::setAutomaticMode(false);
+  Input::use(nullptr);
+  return game;
+}
+
+
+// ==================== GameClient Class Implementation ====================
+GameClient::~GameClient() {
+  close();
+}
+
+// --- MANAGEMENT ---
+bool GameClient::connect(const std::string& socketPath) {
+  sockaddr_un addr;
+  if (fd >= 0 || !socketAddress(socketPath, addr)) return false;
+
+  fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) return false;
+  if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+bool GameClient::send(const std::string& line) {
+  return fd >= 0 && sendAll(fd, line + "\n");
+}
+
+std::optional<std::string> GameClient::receive() {
+  while (fd >= 0) {
+    const std::size_t eol = received.find('\n');
+    if (eol != std::string::npos) {
+      std::string line = received.substr(0, eol);
+      received.erase(0, eol + 1);
+      return line;
+    }
+
+    char buffer[4096];
+    const ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+    if (n > 0) received.append(buffer, static_cast<std::size_t>(n));
+    else if (n == 0 || errno != EINTR) break;
+  }
+  return std::nullopt;
+}
+
+void GameClient::close() {
+  if (fd >= 0) ::close(fd);
+  fd = -1;
+}
+
+#else
+// sockets and epoll are Linux only; elsewhere the server never opens and clients never connect
+GameServer::Session::~Session() = default;
+
+void GameServer::Session::reply(const std::string& line) {}
+
+GameServer::GameServer(std::string socketPath, int workers, int maxTurns) :
+  socketPath(std::move(socketPath)),
+  workerCount(workers),
+  maxTurns(maxTurns) {}
+
+GameServer::~GameServer() = default;
+
+const std::string& GameServer::getSocketPath() const {
+  return socketPath;
+}
+
+std::vector<ServedGame> GameServer::getServed() {
+  return served;
+}
+
+void GameServer::setIdleTimeout(std::chrono::milliseconds timeout) {
+  idleTimeout = timeout;
+}
+
+bool GameServer::open() {
+  std::cerr << "The game server needs Unix domain sockets and epoll (Linux).\n";
+  return false;
+}
+
+void GameServer::run() {}
+
+void GameServer::stop() {}
+
+GameClient::~GameClient() = default;
+
+bool GameClient::connect(const std::string& socketPath) {
+  return false;
+}
+
+bool GameClient::send(const std::string& line) {
+  return false;
+}
+
+std::optional<std::string> GameClient::receive() {
+  return std::nullopt;
+}
+
+void GameClient::close() {}
+#endif
@@ -0,0 +1,126 @@
+#pragma once
+#include "Input.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Outcome of one game hosted by the server.
+ */
+struct ServedGame {
+  int session = 0;
+  int replies = 0;      // commands answered during startup
+  bool started = false; // the client got as far as gamestart
+  std::string winner;   // "Draw" when the turn limit was reached
+  int turns = 0;
+};
+
+
+/**
+ * The GameServer class hosts many games in one process behind a Unix domain socket.
+ * One epoll event loop accepts clients and splits what they send into lines on each session's InputQueue.
+ * The games run on a pool of worker threads and read those queues through Input, exactly as a console game
+ * reads standard input, so the event loop never waits on a game and a game never waits on the socket.
+ *
+ * The protocol is the startup command grammar, one command per line (start, loadmap, validatemap, addplayer,
+ * gamestart, savegame, loadgame). The server greets with "session <id>", answers every command with one line
+ * holding its effect, and after gamestart plays the game out and sends "result <winner> <turns>" before
+ * closing. Engine console output on the server's threads is muted.
+ *
+ * A client whose game waits on it for longer than the idle timeout, or that sends a line longer than
+ * MAX_LINE_LENGTH, gets one "error ..." line and is hung up on, so neither a silent nor a runaway client
+ * can hold a worker or grow a buffer forever. Sessions still queued for a worker, or whose game is being
+ * played out, are never idle.
+ */
+class GameServer {
+public:
+  static constexpr int DEFAULT_MAX_TURNS = 50;
+  static constexpr std::chrono::milliseconds DEFAULT_IDLE_TIMEOUT{std::chrono::minutes(5)};
+  static constexpr std::size_t MAX_LINE_LENGTH = 4096; // bytes in one command, newline excluded
+
+private:
+  struct Session;
+
+  std::string socketPath;
+  int workerCount;
+  int maxTurns;
+  std::chrono::milliseconds idleTimeout = DEFAULT_IDLE_TIMEOUT;
+  int listenFd = -1;
+  int epollFd = -1;
+  int wakeFd = -1;                                            // eventfd that interrupts the event loop
+  std::atomic<bool> stopping = false;
+  std::unordered_map<int, std::shared_ptr<Session>> sessions; // by socket, event loop only
+  int nextSession = 1;
+  std::chrono::steady_clock::time_point nextIdleCheck;
+
+  // worker pool
+  std::mutex poolMutex;
+  std::condition_variable poolReady;
+  std::deque<std::shared_ptr<Session>> waiting;               // sessions no worker has picked up yet
+  std::vector<std::thread> workers;
+  std::vector<ServedGame> served;                             // in the order the games finished
+
+public:
+  explicit GameServer(std::string socketPath, int workers = 0, int maxTurns = DEFAULT_MAX_TURNS); // 0 workers uses Parallelism::available()
+  GameServer(const GameServer& other) = delete;
+  GameServer& operator=(const GameServer& other) = delete;
+  ~GameServer(); // destructor
+
+  // getters
+  const std::string& getSocketPath() const;
+  std::vector<ServedGame> getServed();
+
+  // setters
+  void setIdleTimeout(std::chrono::milliseconds timeout); // before run()
+
+  // management
+  bool open(); // false when the socket cannot be bound
+  void run();  // serves until stop(), then lets the games in progress finish
+  void stop(); // safe from any thread
+
+private:
+  // event loop
+  void acceptClients();
+  void receive(int fd);
+  void hangUp(int fd);
+  void refuse(int fd, const std::string& reason); // tells the client why, then hangs up
+  void dropIdle();
+
+  // worker pool
+  void work();
+  ServedGame play(Session& session);
+};
+
+
+/**
+ * The GameClient class speaks the server's line protocol, as a stand-in for a real front end.
+ */
+class GameClient {
+private:
+  int fd = -1;
+  std::string received; // bytes after the last complete reply
+
+public:
+  GameClient() = default;
+  GameClient(const GameClient& other) = delete;
+  GameClient& operator=(const GameClient& other) = delete;
+  ~GameClient(); // destructor
+
+  // management
+  bool connect(const std::string& socketPath);
+  bool send(const std::string& line);
+  std::optional<std::string> receive(); // next reply, empty once the server has closed the connection
+  void close();
+};
+
+// free function
+void testGameServer();
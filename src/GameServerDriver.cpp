@@ -0,0 +1,122 @@
+#include "GameServer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+  // plays one scripted conversation and keeps everything the server said; a client that starts a game waits
+  // for its result, any other hangs up once each command has been answered
+  std::vector<std::string> converse(const std::string& socketPath, const std::vector<std::string>& commands) {
+    std::vector<std::string> replies;
+    GameClient client;
+    if (!client.connect(socketPath)) return replies;
+
+    for (const std::string& cmd : commands) client.send(cmd);
+    const std::size_t expected = commands.back() == "gamestart" ? SIZE_MAX : commands.size() + 1;
+    while (replies.size() < expected) {
+      const auto reply = client.receive();
+      if (!reply) break;
+      replies.push_back(*reply);
+    }
+    return replies;
+  }
+
+  // sends every command, then keeps listening until the server closes the connection
+  std::vector<std::string> hearOut(const std::string& socketPath, const std::vector<std::string>& commands) {
+    std::vector<std::string> replies;
+    GameClient client;
+    if (!client.connect(socketPath)) return {"no connection"};
+
+    for (const std::string& cmd : commands) client.send(cmd);
+    while (const auto reply = client.receive()) replies.push_back(*reply);
+    return replies;
+  }
+}
+
+/**
+ * Driver function to test the game server
+ * Several stand-in clients connect at once over a Unix domain socket. Three play full games with two AI
+ * players each, one sends commands that are invalid in their state, and one leaves before starting a game.
+ * A second server with a short idle timeout then hangs up on a silent client and on an overlong line.
+ */
+void testGameServer() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "GAME SERVER TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  const std::string socketPath = (std::filesystem::temp_directory_path() / "risk_warzone_test.sock").string();
+  GameServer server(socketPath, 2, 20);
+  if (!server.open()) {
+    std::cout << "Could not open a server socket at " << socketPath << "\n";
+    return;
+  }
+  // the server's threads are muted, and the clients' conversations are reported once it has stopped
+  std::cout << "1. Serving on " << socketPath << " with 2 workers\n" << std::flush;
+  std::thread loop(&GameServer::run, &server);
+
+  const std::vector<std::string> fullGame = {
+    "start", "loadmap Canada/Canada.map", "validatemap", "addplayer Alice", "addplayer Bob", "gamestart"
+  };
+  const std::vector<std::vector<std::string>> scripts = {
+    fullGame,
+    fullGame,
+    {"start", "validatemap", "gamestart", "loadmap France/France.map", "quit"},
+    fullGame,
+    {"start", "loadmap Canada/Canada.map"},
+  };
+
+  std::vector<std::vector<std::string>> conversations(scripts.size());
+  std::vector<std::thread> clients;
+  for (std::size_t i = 0; i < scripts.size(); i++) {
+    clients.emplace_back([&, i] { conversations[i] = converse(socketPath, scripts[i]); });
+  }
+  for (auto& client : clients) client.join();
+
+  // a late client still gets a fresh session from the same server
+  const std::vector<std::string> late = converse(socketPath, {"start", "gamestart", "quit"});
+
+  server.stop();
+  loop.join();
+
+  std::cout << "\n2. Conversations:\n";
+  for (std::size_t i = 0; i < conversations.size(); i++) {
+    std::cout << "  Client " << i + 1 << ":\n";
+    for (const std::string& line : conversations[i]) std::cout << "    < " << line << "\n";
+  }
+
+  std::cout << "\n3. Late client got " << late.size() << " replies, first: " << (late.empty() ? "none" : late.front()) << "\n";
+
+  int started = 0;
+  std::cout << "\n4. Games served:\n";
+  for (const ServedGame& game : server.getServed()) {
+    std::cout << "  session " << game.session << ": " << game.replies << " replies, "
+              << (game.started ? "played, winner " + game.winner + " after " + std::to_string(game.turns) + " turns" : "never started")
+              << "\n";
+    if (game.started) started++;
+  }
+  std::cout << "   All sessions accounted for: " << (server.getServed().size() == scripts.size() + 1 ? "YES" : "NO")
+            << ", games played: " << started << "\n";
+
+  // 5. a client that stops talking mid-setup, and one that never ends its line, are both hung up on
+  GameServer strict(socketPath, 2, 20);
+  strict.setIdleTimeout(std::chrono::milliseconds(200));
+  if (!strict.open()) return;
+  std::thread strictLoop(&GameServer::run, &strict);
+
+  const std::vector<std::string> silent = hearOut(socketPath, {"start", "loadmap Canada/Canada.map"});
+  const std::vector<std::string> runaway = hearOut(socketPath, {std::string(GameServer::MAX_LINE_LENGTH + 1, 'x')});
+
+  strict.stop();
+  strictLoop.join();
+
+  std::cout << "\n5. Limits:\n";
+  std::cout << "  Silent client heard " << silent.size() << " lines, last: " << silent.back() << "\n";
+  std::cout << "  Runaway client heard " << runaway.size() << " lines, last: " << runaway.back() << "\n";
+  std::cout << "   Both hung up on: "
+            << (silent.back().starts_with("error idle") && runaway.back().starts_with("error line") ? "YES" : "NO") << "\n";
+}
@@ -0,0 +1,229 @@
+#include "GameSnapshot.h"
+#include "Cards.h"
+#include "GameEngine.h"
+#include "Map.h"
+#include "Orders.h"
+#include "Player.h"
+
+#include <algorithm>
+#include <string>
+
+/*
+ * Buffer layout (all entries are 32-bit words):
+ *   header       territoryCount, playerCount, deckCount, negotiationCount
+ *   territories  owner slot per territory, then armies per territory
+ *   players      reinforcementPool, pendingReinforcements, flags, handCount, hand card codes in type order...
+ *   deck         card codes in deck order
+ *   negotiations slot pairs
+ * Owner slots index the player roster; playerCount stands for the neutral player and -1 for no owner.
+ */
+namespace {
+  constexpr std::int32_t NO_SLOT = -1;
+  constexpr int HEADER_SIZE = 4;
+
+  constexpr std::int32_t FLAG_CONQUERED = 1 << 0;
+  constexpr std::int32_t FLAG_CAN_ISSUE = 1 << 1;
+  constexpr std::int32_t FLAG_ATTACKED = 1 << 2;
+
+  // card codes are the CardType values
+  bool validCardCode(std::int32_t code) {
+    return code >= 0 && code < CARD_TYPE_COUNT;
+  }
+
+  bool validSlot(std::int32_t slot, std::int32_t playerCount) {
+    return slot >= NO_SLOT && slot <= playerCount;
+  }
+
+  // walks the whole layout before anything is restored: every count must fit in the words left after it and
+  // every slot must name a player, the neutral player or nobody
+  bool wellFormed(const std::vector<std::int32_t>& words) {
+    if (words.size() < HEADER_SIZE) return false;
+    const std::int32_t territoryCount = words[0], playerCount = words[1], deckCount = words[2], negotiationCount = words[3];
+    if (territoryCount < 0 || playerCount < 0 || deckCount < 0 || negotiationCount < 0) return false;
+
+    std::size_t pos = HEADER_SIZE;
+    auto take = [&words, &pos](std::size_t count) {
+      if (count > words.size() - pos) return false;
+      pos += count;
+      return true;
+    };
+
+    if (!take(2 * static_cast<std::size_t>(territoryCount))) return false;
+    for (std::size_t i = pos - 2 * territoryCount; i < pos - territoryCount; i++) {
+      if (!validSlot(words[i], playerCount)) return false;
+    }
+
+    for (std::int32_t p = 0; p < playerCount; p++) {
+      if (!take(4)) return false;
+      const std::int32_t handCount = words[pos - 1];
+      if (handCount < 0 || !take(handCount)) return false;
+    }
+
+    if (!take(deckCount)) return false;
+
+    if (!take(2 * static_cast<std::size_t>(negotiationCount))) return false;
+    for (std::size_t i = pos - 2 * negotiationCount; i < pos; i++) {
+      if (!validSlot(words[i], playerCount)) return false;
+    }
+    return pos == words.size();
+  }
+}
+
+
+// ==================== GameSnapshot Class Implementation ====================
+GameSnapshot::GameSnapshot() = default;
+
+GameSnapshot::GameSnapshot(const GameSnapshot& other) = default;
+
+GameSnapshot& GameSnapshot::operator=(const GameSnapshot& other) = default;
+
+GameSnapshot::~GameSnapshot() = default;
+
+// --- GETTERS ---
+const std::vector<std::int32_t>& GameSnapshot::getBuffer() const {
+  return buffer;
+}
+
+std::size_t GameSnapshot::sizeInBytes() const {
+  return buffer.size() * sizeof(std::int32_t);
+}
+
+// --- SETTERS ---
+void GameSnapshot::setBuffer(const std::vector<std::int32_t>& words) {
+  buffer = words;
+}
+
+// --- CAPTURE AND RESTORE ---
+void GameSnapshot::capture(const Map& map, const std::vector<Player*>& players, const Deck* deck) {
+  const auto& territories = map.getTerritories();
+  const std::vector<CardType>* deckCards = deck ? &deck->getCards() : nullptr;
+  const std::vector<NegotiationRecord>& negotiations = Order::getNegotiationRecords();
+
+  const auto territoryCount = static_cast<std::int32_t>(territories.size());
+  const auto playerCount = static_cast<std::int32_t>(players.size());
+  const auto deckCount = static_cast<std::int32_t>(deckCards ? deckCards->size() : 0);
+  const auto negotiationCount = static_cast<std::int32_t>(negotiations.size());
+
+  auto slotOf = [&players, playerCount](const Player* player) -> std::int32_t {
+    if (!player) return NO_SLOT;
+    const auto it = std::ranges::find(players, player);
+    return it != players.end() ? static_cast<std::int32_t>(it - players.begin()) : playerCount;
+  };
+
+  // size the buffer once so capturing into a reused snapshot does not allocate
+  std::size_t size = HEADER_SIZE + 2 * territoryCount + deckCount + 2 * negotiationCount;
+  for (const Player* player : players) size += 4 + player->getHand()->size();
+  buffer.resize(size);
+
+  std::int32_t* out = buffer.data();
+  *out++ = territoryCount;
+  *out++ = playerCount;
+  *out++ = deckCount;
+  *out++ = negotiationCount;
+
+  for (const auto& terr : territories) *out++ = slotOf(terr->getOwner());
+  for (const auto& terr : territories) *out++ = terr->getArmies();
+
+  for (const Player* player : players) {
+    *out++ = player->getReinforcementPool();
+    *out++ = player->getPendingReinforcements();
+    *out++ = (player->getConqueredThisTurn() ? FLAG_CONQUERED : 0) |
+             (player->getCanIssueOrder() ? FLAG_CAN_ISSUE : 0) |
+             (player->getGotAttackedThisTurn() ? FLAG_ATTACKED : 0);
+
+    const Hand* hand = player->getHand();
+    *out++ = hand->size();
+    for (int type = 0; type < CARD_TYPE_COUNT; type++) {
+      for (int i = hand->count(static_cast<CardType>(type)); i > 0; i--) *out++ = type;
+    }
+  }
+
+  if (deckCards) {
+    for (const CardType card : *deckCards) *out++ = static_cast<std::int32_t>(card);
+  }
+
+  for (const auto& [player1, player2] : negotiations) {
+    *out++ = slotOf(player1);
+    *out++ = slotOf(player2);
+  }
+}
+
+void GameSnapshot::capture(const GameEngine& engine) {
+  if (engine.getMap()) capture(*engine.getMap(), engine.getPlayers(), engine.getDeck());
+}
+
+bool GameSnapshot::restore(const Map& map, const std::vector<Player*>& players, Deck* deck) const {
+  // a malformed buffer (a truncated or edited save file) is refused before anything is touched
+  if (!wellFormed(buffer)) return false;
+
+  const auto& territories = map.getTerritories();
+  const std::int32_t* in = buffer.data();
+  const std::int32_t territoryCount = *in++;
+  const std::int32_t playerCount = *in++;
+  const std::int32_t deckCount = *in++;
+  const std::int32_t negotiationCount = *in++;
+
+  // a snapshot only applies to the map and roster it was taken from
+  if (territoryCount != static_cast<std::int32_t>(territories.size())) return false;
+  if (playerCount != static_cast<std::int32_t>(players.size())) return false;
+
+  auto playerAt = [&players, playerCount](std::int32_t slot) -> Player* {
+    if (slot == NO_SLOT) return nullptr;
+    return slot < playerCount ? players[slot] : GameEngine::getNeutralPlayer();
+  };
+
+  // owners: only touch territories that changed hands
+  for (const auto& terr : territories) {
+    Player* owner = playerAt(*in++);
+    Player* current = terr->getOwner();
+    if (owner == current) continue;
+
+    if (owner) terr->setOwner(owner);
+    else if (current) current->removeTerritory(terr.get());
+  }
+
+  for (const auto& terr : territories) terr->setArmies(*in++);
+
+  for (Player* player : players) {
+    player->setReinforcementPool(*in++);
+    player->setPendingReinforcements(*in++);
+
+    const std::int32_t flags = *in++;
+    player->setConqueredThisTurn(flags & FLAG_CONQUERED);
+    player->setCanIssueOrder(flags & FLAG_CAN_ISSUE);
+    player->setGotAttackedThisTurn(flags & FLAG_ATTACKED);
+
+    const std::int32_t handCount = *in++;
+    Hand* hand = player->getHand();
+    hand->removeAll();
+    for (std::int32_t i = 0; i < handCount; i++) {
+      if (validCardCode(in[i])) hand->addCard(static_cast<CardType>(in[i]));
+    }
+    in += handCount;
+  }
+
+  if (deck) {
+    deck->removeAll();
+    for (std::int32_t i = 0; i < deckCount; i++) {
+      if (validCardCode(in[i])) deck->addCard(static_cast<CardType>(in[i]));
+    }
+  }
+  in += deckCount;
+
+  Order::resetNegotiations();
+  for (std::int32_t i = 0; i < negotiationCount; i++, in += 2) {
+    Order::addNegotiationRecord(playerAt(in[0]), playerAt(in[1]));
+  }
+
+  return true;
+}
+
+bool GameSnapshot::restore(const GameEngine& engine) const {
+  if (!engine.getMap()) return false;
+  return restore(*engine.getMap(), engine.getPlayers(), engine.getDeck());
+}
+
+// --- UTILITY ---
+bool GameSnapshot::operator==(const GameSnapshot& other) const {
+  return buffer == other.buffer;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Deck;
+class GameEngine;
+class Map;
+class Player;
+
+/**
+ * The GameSnapshot class captures the mutable part of a game into one flat buffer of 32-bit words:
+ * territory owners and armies, player pools and flags, hands, deck order and negotiations.
+ * Topology, names and strategies are not captured, so a snapshot restores in place onto the same
+ * map and player roster it was taken from (used for ai search, rollback and save/load).
+ */
+class GameSnapshot {
+private:
+  std::vector<std::int32_t> buffer;
+
+public:
+  GameSnapshot();
+  GameSnapshot(const GameSnapshot& other); // copy constructor
+  GameSnapshot& operator=(const GameSnapshot& other); // assignment operator
+  ~GameSnapshot(); // destructor
+
+  // getters
+  const std::vector<std::int32_t>& getBuffer() const;
+  std::size_t sizeInBytes() const;
+
+  // setters
+  void setBuffer(const std::vector<std::int32_t>& words);
+
+  // capture and restore
+  void capture(const Map& map, const std::vector<Player*>& players, const Deck* deck);
+  void capture(const GameEngine& engine);
+  bool restore(const Map& map, const std::vector<Player*>& players, Deck* deck) const;
+  bool restore(const GameEngine& engine) const;
+
+  // utility
+  bool operator==(const GameSnapshot& other) const;
+};
+
+// free function
+void testGameSnapshot();
@@ -0,0 +1,113 @@
+#include "Cards.h"
+#include "GameSnapshot.h"
+#include "Map.h"
+#include "Orders.h"
+#include "Player.h"
+#include "Utility.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+void testGameSnapshot() {
+  std::cout << "\n=== Testing Game Snapshots ===" << std::endl;
+
+  // build a small map with two players
+  Map* map = new Map("Snapshot Map");
+  Continent* continent = map->addContinent("Snapshot Continent", 1, 2);
+  std::vector<Territory*> terrs;
+  for (int i = 0; i < 4; i++) {
+    terrs.push_back(map->addTerritory("Territory" + std::to_string(i + 1), i + 1));
+    continent->addTerritory(terrs.back());
+    if (i > 0) Map::addAdjacency(terrs[i - 1], terrs[i]);
+  }
+
+  Deck* deck = new Deck();
+  Player* alice = new Player("Alice", deck);
+  Player* bob = new Player("Bob", deck);
+  std::vector<Player*> players = {alice, bob};
+
+  terrs[0]->setOwner(alice);
+  terrs[1]->setOwner(alice);
+  terrs[2]->setOwner(bob);
+  terrs[3]->setOwner(bob);
+  for (int i = 0; i < 4; i++) terrs[i]->setArmies(5 + i);
+
+  alice->setReinforcementPool(7);
+  if (const auto card = deck->draw(GameRandom::get())) alice->addCard(*card);
+  if (const auto card = deck->draw(GameRandom::get())) bob->addCard(*card);
+
+  // 1. capture the initial position
+  std::cout << "\n1. Capturing the initial position:" << std::endl;
+  GameSnapshot snapshot;
+  snapshot.capture(*map, players, deck);
+  std::cout << "Snapshot size: " << snapshot.sizeInBytes() << " bytes" << std::endl;
+
+  // 2. mutate the game: conquest, army changes, card draws and a negotiation
+  std::cout << "\n2. Mutating the game state:" << std::endl;
+  terrs[2]->setOwner(alice);
+  terrs[2]->setArmies(1);
+  terrs[0]->setArmies(20);
+  alice->setReinforcementPool(0);
+  alice->setConqueredThisTurn(true);
+  if (const auto card = deck->draw(GameRandom::get())) bob->addCard(*card);
+  Order::addNegotiationRecord(alice, bob);
+
+  GameSnapshot mutated;
+  mutated.capture(*map, players, deck);
+  std::cout << "Territory3 owner after mutation: " << terrs[2]->getOwner()->getName() << std::endl;
+  std::cout << "Mutated state differs from snapshot: " << (mutated == snapshot ? "no" : "yes") << std::endl;
+
+  // 3. restore and verify the game matches the snapshot again
+  std::cout << "\n3. Restoring the snapshot:" << std::endl;
+  const bool restored = snapshot.restore(*map, players, deck);
+
+  GameSnapshot check;
+  check.capture(*map, players, deck);
+  std::cout << "Restore succeeded: " << (restored ? "yes" : "no") << std::endl;
+  std::cout << "Territory3 owner after restore: " << terrs[2]->getOwner()->getName() << std::endl;
+  std::cout << "Alice owns " << alice->getTerritories().size() << " territories, Bob owns "
+            << bob->getTerritories().size() << std::endl;
+  std::cout << "Restored state matches snapshot: " << (check == snapshot ? "yes" : "no") << std::endl;
+  std::cout << "Negotiations after restore: " << Order::getNegotiationRecords().size() << std::endl;
+
+  // 4. a snapshot must refuse a different roster
+  std::cout << "\n4. Restoring onto a different roster:" << std::endl;
+  std::vector<Player*> wrongRoster = {alice};
+  std::cout << "Restore refused: " << (snapshot.restore(*map, wrongRoster, deck) ? "no" : "yes") << std::endl;
+
+  // a truncated buffer or a slot below NO_SLOT is refused without touching the game
+  GameSnapshot corrupt;
+  std::vector<std::int32_t> words = snapshot.getBuffer();
+  words.pop_back();
+  corrupt.setBuffer(words);
+  std::cout << "Truncated snapshot refused: " << (corrupt.restore(*map, players, deck) ? "no" : "yes") << std::endl;
+  words = snapshot.getBuffer();
+  words[4] = -2;
+  corrupt.setBuffer(words);
+  std::cout << "Bad owner slot refused: " << (corrupt.restore(*map, players, deck) ? "no" : "yes") << std::endl;
+  check.capture(*map, players, deck);
+  std::cout << "Game untouched after refusals: " << (check == snapshot ? "yes" : "no") << std::endl;
+
+  // 5. time repeated capture/restore cycles (the rollback pattern used by search)
+  std::cout << "\n5. Timing capture/restore cycles:" << std::endl;
+  constexpr int cycles = 10000;
+  GameSnapshot scratch;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < cycles; i++) {
+    scratch.capture(*map, players, deck);
+    terrs[i % 4]->setArmies(i);
+    scratch.restore(*map, players, deck);
+  }
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start
+  ).count();
+  std::cout << cycles << " cycles took " << elapsed << " us" << std::endl;
+
+  // cleanup
+  Order::resetNegotiations();
+  delete alice;
+  delete bob;
+  delete deck;
+  delete map;
+}
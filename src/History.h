@@ -0,0 +1,122 @@
+#pragma once
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * The BoundedHistory class keeps the most recent entries in a fixed-capacity ring.
+ * Once the ring is full each new entry evicts the oldest one, which is appended to the journal file as
+ * one encoded line when a journal is set, and dropped otherwise.
+ * Copies take the entries still in memory; the journal stays with the original.
+ */
+template <typename T>
+class BoundedHistory {
+public:
+  using Encoder = std::string (*)(const T& entry); // must not produce line breaks
+
+private:
+  std::vector<T> ring;
+  std::size_t capacity;
+  std::size_t oldest = 0;        // ring position of the oldest entry once the ring is full
+  std::size_t evicted = 0;       // entries pushed out of the ring so far
+  Encoder encode;
+  std::string journalPath;
+  mutable std::ofstream journal; // flushed before the journal is read back
+
+public:
+  BoundedHistory(std::size_t capacity, Encoder encode) :
+    capacity(capacity > 0 ? capacity : 1),
+    encode(encode) {
+    ring.reserve(this->capacity);
+  }
+
+  BoundedHistory(const BoundedHistory& other) :
+    capacity(other.capacity),
+    encode(other.encode) {
+    ring.reserve(capacity);
+    other.forEach([this](const T& entry) { ring.push_back(entry); });
+  }
+
+  BoundedHistory& operator=(const BoundedHistory& other) {
+    if (this != &other) {
+      ring.clear();
+      capacity = other.capacity;
+      oldest = 0;
+      evicted = 0;
+      encode = other.encode;
+      closeJournal();
+
+      ring.reserve(capacity);
+      other.forEach([this](const T& entry) { ring.push_back(entry); });
+    }
+    return *this;
+  }
+
+  ~BoundedHistory() = default;
+
+  // getters
+  std::size_t size() const { return ring.size(); }          // entries in memory
+  std::size_t getEvicted() const { return evicted; }        // entries no longer in memory
+  const std::string& getJournalPath() const { return journalPath; }
+  bool empty() const { return ring.empty(); }
+
+  const T& back() const {
+    return ring.size() < capacity ? ring.back() : ring[(oldest + capacity - 1) % capacity];
+  }
+
+  // journal management
+  bool setJournal(const std::string& path) { // starts a fresh journal file, empty path stops journaling
+    closeJournal();
+    if (path.empty()) return true;
+
+    journal.open(path, std::ios::trunc);
+    if (!journal) return false;
+
+    journalPath = path;
+    return true;
+  }
+
+  std::vector<std::string> readJournal() const { // evicted entries still on disk, oldest first
+    std::vector<std::string> lines;
+    if (journalPath.empty()) return lines;
+
+    journal.flush();
+    std::ifstream in(journalPath);
+    for (std::string line; std::getline(in, line);) lines.push_back(std::move(line));
+    return lines;
+  }
+
+  // management
+  void push(T entry) {
+    if (ring.size() < capacity) {
+      ring.push_back(std::move(entry));
+      return;
+    }
+
+    // full: the oldest slot is written out (when journaling) and reused
+    if (journal.is_open()) journal << encode(ring[oldest]) << '\n';
+    ring[oldest] = std::move(entry);
+    oldest = (oldest + 1) % capacity;
+    evicted++;
+  }
+
+  void clear() { // drops the in-memory entries; the journal keeps its lines and later evictions append to it
+    ring.clear();
+    oldest = 0;
+  }
+
+  // utility
+  template <typename Visitor>
+  void forEach(Visitor&& visit) const { // in-memory entries, oldest first
+    for (std::size_t i = 0; i < ring.size(); i++) visit(ring[(oldest + i) % ring.size()]);
+  }
+
+private:
+  // helpers
+  void closeJournal() {
+    if (journal.is_open()) journal.close();
+    journalPath.clear();
+  }
+};
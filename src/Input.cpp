@@ -0,0 +1,170 @@
+#include "Input.h"
+
+#include <cctype>
+#include <iostream>
+#include <thread>
+
+// ==================== InputQueue Class Implementation ====================
+// --- GETTERS ---
+bool InputQueue::isClosed() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return closed;
+}
+
+std::size_t InputQueue::size() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return lines.size();
+}
+
+// --- PRODUCERS ---
+void InputQueue::push(std::string line) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t start = 0;
+    for (std::size_t end; (end = line.find('\n', start)) != std::string::npos; start = end + 1) {
+      lines.push_back(line.substr(start, end - start));
+    }
+    lines.push_back(start == 0 ? std::move(line) : line.substr(start));
+  }
+  ready.notify_one();
+}
+
+void InputQueue::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    closed = true;
+  }
+  ready.notify_all();
+}
+
+// --- CONSUMER ---
+std::optional<std::string> InputQueue::tryPop() {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (lines.empty()) return std::nullopt;
+
+  std::string line = std::move(lines.front());
+  lines.pop_front();
+  return line;
+}
+
+std::optional<std::string> InputQueue::pop(const std::function<void()>& idle) {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (lines.empty() && !closed) {
+    if (idle) {
+      // the task runs unlocked so producers are never held up by it
+      lock.unlock();
+      idle();
+      lock.lock();
+      ready.wait_for(lock, IDLE_INTERVAL, [this] { return !lines.empty() || closed; });
+    } else {
+      ready.wait(lock, [this] { return !lines.empty() || closed; });
+    }
+  }
+  if (lines.empty()) return std::nullopt;
+
+  std::string line = std::move(lines.front());
+  lines.pop_front();
+  return line;
+}
+
+std::optional<std::string> InputQueue::popLine(const std::function<void()>& idle) {
+  // words left over after reading tokens belong to the next line read, unless only blanks are left
+  const std::size_t rest = pending.find_first_not_of(" \t\r", pendingPos);
+  if (rest != std::string::npos) {
+    std::string line = pending.substr(rest);
+    pending.clear();
+    pendingPos = 0;
+    return line;
+  }
+  pending.clear();
+  pendingPos = 0;
+
+  std::optional<std::string> line = pop(idle);
+  if (line && !line->empty() && line->back() == '\r') line->pop_back();
+  return line;
+}
+
+std::optional<std::string> InputQueue::popToken(const std::function<void()>& idle) {
+  auto isBlank = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+
+  while (true) {
+    while (pendingPos < pending.size() && isBlank(pending[pendingPos])) pendingPos++;
+    if (pendingPos < pending.size()) break;
+
+    std::optional<std::string> line = pop(idle);
+    if (!line) return std::nullopt;
+    pending = std::move(*line);
+    pendingPos = 0;
+  }
+
+  const std::size_t begin = pendingPos;
+  while (pendingPos < pending.size() && !isBlank(pending[pendingPos])) pendingPos++;
+  return pending.substr(begin, pendingPos - begin);
+}
+
+
+// ==================== Input Class Implementation ====================
+namespace {
+  thread_local InputQueue* current = nullptr; // nullptr reads from the console
+  thread_local std::function<void()> idleTask;
+
+  // std::cin is no longer read on this thread, so its tie no longer flushes a pending prompt
+  void promptConsole() {
+    if (!current) std::cout.flush();
+  }
+}
+
+Input::IdleScope::IdleScope(std::function<void()> task) :
+  previous(std::move(idleTask)) {
+  idleTask = std::move(task);
+}
+
+Input::IdleScope::~IdleScope() {
+  idleTask = std::move(previous);
+}
+
+// --- GETTERS ---
+InputQueue& Input::queue() {
+  return current ? *current : console();
+}
+
+InputQueue& Input::console() {
+  // never destroyed: the reader stays blocked on std::cin in the background and may outlive main
+  static InputQueue* const consoleQueue = new InputQueue();
+  static std::once_flag started;
+
+  std::call_once(started, [] {
+    std::thread([] {
+      for (std::string line; std::getline(std::cin, line);) consoleQueue->push(std::move(line));
+      consoleQueue->close();
+    }).detach();
+  });
+  return *consoleQueue;
+}
+
+// --- SETTERS ---
+void Input::use(InputQueue* source) {
+  current = source;
+}
+
+// --- READING ---
+std::string Input::readLine() {
+  promptConsole();
+  return queue().popLine(idleTask).value_or("");
+}
+
+std::string Input::readToken() {
+  promptConsole();
+  return queue().popToken(idleTask).value_or("");
+}
+
+int Input::readInt(int fallback) {
+  const std::string token = readToken();
+  try {
+    std::size_t used = 0;
+    const int value = std::stoi(token, &used);
+    return used == token.size() ? value : fallback;
+  } catch (const std::exception&) {
+    return fallback;
+  }
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+
+/**
+ * The InputQueue class is a thread-safe queue of input lines shared by any number of producers
+ * (the console reader, a local socket, a script or a test) and a single consumer, the engine thread.
+ * A consumer that finds the queue empty is suspended rather than blocked: while it waits it keeps running
+ * its idle task, so the engine can do useful work until the next line arrives.
+ */
+class InputQueue {
+public:
+  static constexpr std::chrono::milliseconds IDLE_INTERVAL{20}; // how often a waiting consumer runs its idle task
+
+private:
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::deque<std::string> lines;
+  bool closed = false;
+
+  // consumer side only
+  std::string pending;        // rest of the line tokens are currently read from
+  std::size_t pendingPos = 0;
+
+public:
+  InputQueue() = default;
+  InputQueue(const InputQueue& other) = delete;
+  InputQueue& operator=(const InputQueue& other) = delete;
+  ~InputQueue() = default;
+
+  // getters
+  bool isClosed();
+  std::size_t size();
+
+  // producers
+  void push(std::string line); // multi-line text is split into one entry per line
+  void close();                // wakes the consumer; lines already queued are still delivered
+
+  // consumer
+  std::optional<std::string> tryPop();                                 // never waits
+  std::optional<std::string> pop(const std::function<void()>& idle = {}); // empty once closed and drained
+  std::optional<std::string> popLine(const std::function<void()>& idle = {}); // rest of a partly read line first
+  std::optional<std::string> popToken(const std::function<void()>& idle = {}); // next word, across lines
+};
+
+
+/**
+ * The Input class is where every interactive decision of the engine reads its answer from.
+ * Each thread reads from its own queue, the shared console queue unless another one is in use, so games
+ * served by different threads each get their own input. The console queue is fed by a background reader
+ * started on first use, which is the only code that touches std::cin.
+ */
+class Input {
+public:
+  /**
+   * Runs a task whenever the current thread waits on its input, for as long as the scope lives.
+   */
+  class IdleScope {
+  private:
+    std::function<void()> previous;
+
+  public:
+    explicit IdleScope(std::function<void()> task);
+    IdleScope(const IdleScope& other) = delete;
+    IdleScope& operator=(const IdleScope& other) = delete;
+    ~IdleScope();
+  };
+
+  // getters
+  static InputQueue& queue();   // the queue the current thread reads from
+  static InputQueue& console(); // the queue fed from standard input
+
+  // setters
+  static void use(InputQueue* source); // nullptr goes back to the console queue, for the current thread only
+
+  // reading
+  static std::string readLine();                   // empty once the input is closed and drained
+  static std::string readToken();                  // empty once the input is closed and drained
+  static int readInt(int fallback = -1);           // fallback when the next word is not a number
+};
+
+// free function
+void testInputQueue();
@@ -0,0 +1,65 @@
+#include "CommandProcessing.h"
+#include "Input.h"
+#include "Player.h"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+/**
+ * Driver function to test the input pipeline
+ * A producer thread feeds a queue line by line while the engine side reads words, numbers and whole lines
+ * from it, doing idle work whenever it has to wait. The same queue then answers a command processor and a
+ * player choice in place of the console.
+ */
+void testInputQueue() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "INPUT QUEUE TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  InputQueue queue;
+  Input::use(&queue);
+
+  // 1. answers arrive slowly from another thread; the reader keeps working in between
+  std::thread producer([&queue] {
+    for (const char* line : {"alpha  beta", "42 oops", "rest of the line", "loadmap Canada/Canada.map"}) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(60));
+      queue.push(line);
+    }
+  });
+
+  int idleRuns = 0;
+  {
+    Input::IdleScope idle([&idleRuns] { idleRuns++; });
+    const std::string first = Input::readToken();
+    const std::string second = Input::readToken();
+    const int number = Input::readInt();
+    const int invalid = Input::readInt(-7);
+    const std::string line = Input::readLine();
+
+    std::cout << "1. Read '" << first << "', '" << second << "', " << number << ", " << invalid
+              << " (not a number), then line '" << line << "'\n";
+    std::cout << "   Idle task ran " << idleRuns << " times while waiting: " << (idleRuns > 0 ? "YES" : "NO") << "\n";
+  }
+
+  // 2. a console command processor reads from whichever queue the thread uses
+  CommandProcessor processor;
+  Command* cmd = processor.getCommand();
+  std::cout << "\n2. Command processor got: " << cmd->getCommand() << "\n";
+  producer.join();
+
+  // 3. a choice prompt skips answers that are out of range or not numbers
+  Player first("First", nullptr);
+  Player second("Second", nullptr);
+  queue.push("5 x\n1");
+  const Player* chosen = Player::choosePlayer({&first, &second});
+  std::cout << "\n3. Chosen player: " << (chosen ? chosen->getName() : "none") << "\n";
+
+  // 4. once the producers are gone, reads come back empty instead of waiting forever
+  queue.close();
+  const bool drained = Input::readLine().empty() && Input::readToken().empty();
+  std::cout << "4. Closed queue reads empty: " << (drained ? "YES" : "NO") << "\n";
+
+  Input::use(nullptr);
+}
@@ -20,39 +20,35 @@ Observer::~Observer() = default;
 
 
 // ==================== Subject Class Implementation ====================
-Subject::Subject() : observers(new std::vector<Observer*>()) {}
+Subject::Subject() = default;
 
-Subject::Subject(const Subject& other) : observers(new std::vector(*other.observers)) {}
+Subject::Subject(const Subject& other) = default;
 
-Subject& Subject::operator=(const Subject& other) {
-  if (this != &other) {
-    delete observers;
-    observers = new std::vector(*other.observers);
-  }
-  return *this;
-}
+Subject::Subject(Subject&& other) noexcept = default;
 
-Subject::~Subject() {
-  delete observers;
-}
+Subject& Subject::operator=(const Subject& other) = default;
+
+Subject& Subject::operator=(Subject&& other) noexcept = default;
+
+Subject::~Subject() = default;
 
 // --- MANAGEMENT ---
 void Subject::attach(Observer* obs) {
   if (!obs) return;
 
-  for (Observer* oldObs : *observers) {
+  for (Observer* oldObs : observers) {
     if (oldObs == obs) return;
   }
-  observers->push_back(obs);
+  observers.push_back(obs);
 }
 
 void Subject::detach(Observer* obs) {
   if (!obs) return;
-  std::erase(*observers, obs);
+  std::erase(observers, obs);
 }
 
 void Subject::notify() {
-  for (Observer* obs : *observers) {
+  for (Observer* obs : observers) {
     if (obs) { obs->update(this); }
   }
 }
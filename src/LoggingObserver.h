@@ -28,12 +28,14 @@ public:
 
 class Subject {
 protected:
-  std::vector<Observer*>* observers;
+  std::vector<Observer*> observers;
 
 public:
   Subject();
   Subject(const Subject& other); // copy constructor
+  Subject(Subject&& other) noexcept; // move constructor
   Subject& operator=(const Subject& other); // assignment operator
+  Subject& operator=(Subject&& other) noexcept; // move assignment operator
   virtual ~Subject(); // destructor
 
   // management
@@ -22,6 +22,7 @@ void testLoggingObserver() {
   CommandProcessor processor;
   processor.attach(&logger);
 
+  // saveCommand takes ownership of the commands
   Command* cmdLoadMap = new Command("loadmap World.map");
   processor.saveCommand(cmdLoadMap);
   cmdLoadMap->saveEffect("Loaded map World.map");
@@ -34,9 +35,9 @@ void testLoggingObserver() {
   OrdersList ordersList;
   ordersList.attach(&logger);
 
-  Deck* deck = new Deck();
-  Player playerOne("Alice", deck);
-  Player playerTwo("Bob", deck);
+  Deck deck;
+  Player playerOne("Alice", &deck);
+  Player playerTwo("Bob", &deck);
   Territory territoryAlpha("Alpha", 1);
   Territory territoryBeta("Beta", 2);
 
@@ -51,21 +52,23 @@ void testLoggingObserver() {
   territoryBeta.setOwner(&playerTwo);
 
   int deployArmies = 5;
-  OrderDeploy* deployOrder = new OrderDeploy(&playerOne, &territoryAlpha, &deployArmies);
-  ordersList.addOrder(deployOrder);
+  auto deployOwned = std::make_unique<OrderDeploy>(&playerOne, &territoryAlpha, deployArmies);
+  OrderDeploy* deployOrder = deployOwned.get();
+  ordersList.addOrder(std::move(deployOwned));
   deployOrder->execute();
 
   int advanceArmies = 3;
-  OrderAdvance* advanceOrder = new OrderAdvance(&playerOne, &territoryAlpha, &territoryBeta, &advanceArmies);
-  ordersList.addOrder(advanceOrder);
+  auto advanceOwned = std::make_unique<OrderAdvance>(&playerOne, &territoryAlpha, &territoryBeta, advanceArmies);
+  OrderAdvance* advanceOrder = advanceOwned.get();
+  ordersList.addOrder(std::move(advanceOwned));
   advanceOrder->execute();
 
   // ---- game engine logging ----
   GameEngine engine;
   engine.attach(&logger);
-  engine.transitionState("start");
-  engine.transitionState("map loaded");
-  engine.transitionState("map validated");
+  engine.transitionState(GameState::START);
+  engine.transitionState(GameState::MAP_LOADED);
+  engine.transitionState(GameState::MAP_VALIDATED);
 
   std::cout << "Logging complete. Review gamelog.txt for entries." << std::endl;
 }
@@ -18,6 +18,23 @@ void testLoggingObserver();
 void testPlayerStrategies();
 void testTournament();
 
+// extensions
+void testGameSnapshot();
+void testSaveLoad();
+void testTournamentCheckpoint();
+void testTournamentExport();
+void testProfiler();
+void testTracer();
+void testAllocationTracking();
+void testCommandBatch();
+void testInputQueue();
+void testGameServer();
+void testTournamentSpec();
+void testTournamentScheduler();
+void testTallyKernels();
+void testEarlyGameEnd();
+void testMapDistances();
+
 
 /**
  * The main driver calls the test functions for each part which
@@ -103,6 +120,96 @@ int main() {
     std::cout << std::string(50, '=') << std::endl;
     testTournament();
 
+    // Part 13: Game Snapshot Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 13: GAME SNAPSHOT TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testGameSnapshot();
+
+    // Part 14: Save/Load Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 14: SAVE/LOAD TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testSaveLoad();
+
+    // Part 15: Tournament Checkpoint Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 15: TOURNAMENT CHECKPOINT TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testTournamentCheckpoint();
+
+    // Part 16: Tournament Export Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 16: TOURNAMENT EXPORT TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testTournamentExport();
+
+    // Part 17: Profiler Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 17: PROFILER TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testProfiler();
+
+    // Part 18: Trace Export Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 18: TRACE EXPORT TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testTracer();
+
+    // Part 19: Allocation Tracking Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 19: ALLOCATION TRACKING TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testAllocationTracking();
+
+    // Part 20: Command Batch Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 20: COMMAND BATCH TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testCommandBatch();
+
+    // Part 21: Input Queue Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 21: INPUT QUEUE TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testInputQueue();
+
+    // Part 22: Game Server Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 22: GAME SERVER TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testGameServer();
+
+    // Part 23: Tournament Spec Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 23: TOURNAMENT SPEC TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testTournamentSpec();
+
+    // Part 24: Tournament Scheduler Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 24: TOURNAMENT SCHEDULER TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testTournamentScheduler();
+
+    // Part 25: Tally Kernel Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 25: TALLY KERNEL TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testTallyKernels();
+
+    // Part 26: Early Game End Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 26: EARLY GAME END TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testEarlyGameEnd();
+
+    // Part 27: Map Distances Testing
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "PART 27: MAP DISTANCES TESTING" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    testMapDistances();
+
     std::cout << "\n" << std::string(50, '=') << std::endl;
     std::cout << "ALL WARZONE TESTS COMPLETED SUCCESSFULLY" << std::endl;
     std::cout << std::string(50, '=') << std::endl;
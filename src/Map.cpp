@@ -1,75 +1,96 @@
 #include "Map.h"
 #include "GameEngine.h"
 #include "Player.h"
+#include "Utility.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <queue>
 #include <ranges>
 #include <sstream>
+#include <thread>
 #include <unordered_set>
 
+// x86 gcc/clang builds carry avx2 tally kernels, picked at runtime when the cpu supports them
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RISK_AVX2_KERNELS
+#include <immintrin.h>
+#endif
+
 
 // ==================== Territory Class Implementation ====================
 Territory::Territory() :
-  name(new std::string("")),
-  id(new int(0)),
+  id(0),
+  index(-1),
   owner(nullptr),
-  armies(new int(0)),
-  adjTerritories(new std::vector<Territory*>()),
-  continent(nullptr) {}
+  armies(0),
+  changedAt(0),
+  continent(nullptr),
+  map(nullptr) {}
 
 Territory::Territory(const std::string& name, int id) :
-  name(new std::string(name)),
-  id(new int(id)),
+  name(name),
+  id(id),
+  index(-1),
   owner(nullptr),
-  armies(new int(0)),
-  adjTerritories(new std::vector<Territory*>()),
-  continent(nullptr) {}
+  armies(0),
+  changedAt(0),
+  continent(nullptr),
+  map(nullptr) {}
 
 Territory::Territory(const Territory& other) :
-  name(new std::string(*other.name)),
-  id(new int(*other.id)),
+  name(other.name),
+  id(other.id),
+  index(other.index),
   owner(nullptr),
-  armies(new int(*other.armies)),
-  adjTerritories(new std::vector<Territory*>()),
-  continent(nullptr) {}
+  armies(other.armies),
+  changedAt(0),
+  continent(nullptr),
+  map(nullptr) {}
+
+Territory::Territory(Territory&& other) noexcept = default;
 
 Territory& Territory::operator=(const Territory& other) {
   if (this != &other) {
-    delete name;
-    delete id;
-    delete armies;
-    delete adjTerritories;
-
-    // deep copy primitives and container
-    name = new std::string(*other.name);
-    id = new int(*other.id);
-    armies = new int(*other.armies);
-    adjTerritories = new std::vector(*other.adjTerritories);
+    name = other.name;
+    id = other.id;
+    index = other.index;
+    armies = other.armies;
+    changedAt = other.changedAt;
+    adjTerritories = other.adjTerritories;
+    adjByIndex = other.adjByIndex;
 
     // shallow copy shared references
     owner = other.owner;
     continent = other.continent;
+    map = other.map;
   }
   return *this;
 }
 
-Territory::~Territory() {
-  delete name;
-  delete id;
-  delete armies;
-  delete adjTerritories;
-}
+Territory& Territory::operator=(Territory&& other) noexcept = default;
+
+Territory::~Territory() = default;
 
 // --- GETTERS ---
-std::string Territory::getName() const {
-  return *name;
+const std::string& Territory::getName() const {
+  return name;
 }
 
 int Territory::getId() const {
-  return *id;
+  return id;
+}
+
+int Territory::getIndex() const {
+  return index;
+}
+
+Map* Territory::getMap() const {
+  return map;
 }
 
 Player* Territory::getOwner() const {
@@ -77,11 +98,15 @@ Player* Territory::getOwner() const {
 }
 
 int Territory::getArmies() const {
-  return *armies;
+  return armies;
+}
+
+std::uint64_t Territory::getChangedAt() const {
+  return changedAt;
 }
 
 const std::vector<Territory*>& Territory::getAdjTerritories() const {
-  return *adjTerritories;
+  return adjTerritories;
 }
 
 Continent* Territory::getContinent() const {
@@ -90,11 +115,16 @@ Continent* Territory::getContinent() const {
 
 // --- SETTERS ---
 void Territory::setName(const std::string& newName) {
-  *name = newName;
+  name = newName;
 }
 
 void Territory::setId(int newId) {
-  *id = newId;
+  id = newId;
+}
+
+void Territory::setIndex(int newIndex) {
+  index = newIndex;
+  if (map) map->resetLayout();
 }
 
 void Territory::setOwner(Player* newOwner) {
@@ -102,58 +132,80 @@ void Territory::setOwner(Player* newOwner) {
 
   Player* oldOwner = owner;
   owner = newOwner;
+  stampChange();
 
   // handle territory change
   newOwner->addTerritory(this);
   if (oldOwner) {
     oldOwner->removeTerritory(this);
   }
+
+  // both territory lists are settled by now, so listeners see the new counts
+  if (map) {
+    map->syncOwner(index, newOwner);
+    map->notifyOwnerChanged(this, oldOwner);
+  }
 }
 
 void Territory::setArmies(int newArmies) {
-  *armies = newArmies;
+  if (armies == newArmies) return;
+
+  armies = newArmies;
+  stampChange();
+  if (map) map->syncArmies(index, newArmies);
 }
 
 void Territory::setContinent(Continent* newContinent) {
   continent = newContinent;
+  if (map) map->resetLayout();
+}
+
+void Territory::setMap(Map* newMap) {
+  map = newMap;
 }
 
 // --- MANAGEMENT ---
 bool Territory::isAdjacentTo(const Territory* terr) const {
-  return std::ranges::any_of(*adjTerritories, [terr](const Territory* t) {
-    return t == terr;
-  });
+  if (!terr) return false;
+
+  // only territories outside a map share an index (-1), so the range is a single entry on a loaded map
+  const auto [first, last] = std::ranges::equal_range(adjByIndex, terr->index, {}, &Territory::index);
+  return std::find(first, last, terr) != last;
 }
 
 void Territory::addAdjTerritory(Territory* terr) {
   if (!terr || terr == this) return;
 
-  // ensure no duplicates
-  if (!isAdjacentTo(terr)) {
-    adjTerritories->push_back(terr);
-  }
+  // the sorted insert point doubles as the duplicate check
+  const auto [first, last] = std::ranges::equal_range(adjByIndex, terr->index, {}, &Territory::index);
+  if (std::find(first, last, terr) != last) return;
+
+  adjByIndex.insert(last, terr);
+  adjTerritories.push_back(terr);
+  if (map) map->resetDistances();
 }
 
 void Territory::removeAdjTerritory(Territory* terr) {
-  std::erase(*adjTerritories, terr);
+  std::erase(adjTerritories, terr);
+  std::erase(adjByIndex, terr);
+  if (map) map->resetDistances();
 }
 
 // --- UTILITY ---
 void Territory::displayInfo() const {
-  std::cout << "Territory: " << (name ? *name : "<Unnamed>")
-            << " (ID: " << (id ? *id : -1) << ")" << std::endl;
+  std::cout << "Territory: " << name << " (ID: " << id << ")" << std::endl;
 
   std::cout << "  Owner: " << (owner ? owner->getName() : "None")
-            << ", Armies: " << (armies ? *armies : 0) << std::endl;
+            << ", Armies: " << armies << std::endl;
   std::cout << "  Continent: " << (continent ? continent->getName() : "None") << std::endl;
 
   std::cout << "  Adjacent to: ";
-  if (adjTerritories->empty()) {
+  if (adjTerritories.empty()) {
     std::cout << "None";
   } else {
-    for (size_t i = 0; i < adjTerritories->size(); i++) {
-      std::cout << ((*adjTerritories)[i] ? (*adjTerritories)[i]->getName() : "None");
-      if (i < adjTerritories->size() - 1) {
+    for (size_t i = 0; i < adjTerritories.size(); i++) {
+      std::cout << (adjTerritories[i] ? adjTerritories[i]->getName() : "None");
+      if (i < adjTerritories.size() - 1) {
         std::cout << ", ";
       }
     }
@@ -168,94 +220,90 @@ bool Territory::operator==(const Territory& other) const {
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const Territory& terr) {
-  os << "Territory["
-     << (terr.name ? *terr.name : "<Unnamed>")
-     << " (ID:" << (terr.id ? *terr.id : -1) << "), ";
+  os << "Territory[" << terr.name << " (ID:" << terr.id << "), ";
 
   os << "Owner:" << (terr.owner ? terr.owner->getName() : "None") << ", ";
-  os << "Armies:" << (terr.armies ? *terr.armies : 0) << ", ";
+  os << "Armies:" << terr.armies << ", ";
 
   os << "Continent:" << (terr.continent ? terr.continent->getName() : "None") << ", ";
-  os << "Adjacent:" << terr.adjTerritories->size() << "]";
+  os << "Adjacent:" << terr.adjTerritories.size() << "]";
   return os;
 }
 
+// --- HELPERS ---
+void Territory::stampChange() {
+  // outside of a map there is no version to compare against, so nothing relies on the stamp
+  if (!map) return;
+
+  map->bumpStateVersion();
+  changedAt = map->getStateVersion();
+}
+
 
 // ==================== Continent Class Implementation ====================
 Continent::Continent() :
-  name(new std::string("")),
-  id(new int(0)),
-  bonus(new int(0)),
-  territories(new std::vector<Territory*>()) {}
+  id(0),
+  bonus(0) {}
 
 Continent::Continent(const std::string& name, int id, int bonus) :
-  name(new std::string(name)),
-  id(new int(id)),
-  bonus(new int(bonus)),
-  territories(new std::vector<Territory*>()) {}
+  name(name),
+  id(id),
+  bonus(bonus) {}
 
 Continent::Continent(const Continent& other) :
-  name(new std::string(*other.name)),
-  id(new int(*other.id)),
-  bonus(new int(*other.bonus)),
-  territories(new std::vector<Territory*>()) {}
+  name(other.name),
+  id(other.id),
+  bonus(other.bonus) {}
+
+Continent::Continent(Continent&& other) noexcept = default;
 
 Continent& Continent::operator=(const Continent& other) {
   if (this != &other) {
-    delete name;
-    delete id;
-    delete bonus;
-    delete territories;
-
-    // deep copy primitives and container
-    name = new std::string(*other.name);
-    id = new int(*other.id);
-    bonus = new int(*other.bonus);
-    territories = new std::vector(*other.territories);
+    name = other.name;
+    id = other.id;
+    bonus = other.bonus;
+    territories = other.territories;
   }
   return *this;
 }
 
-Continent::~Continent() {
-  delete name;
-  delete id;
-  delete bonus;
-  delete territories;
-}
+Continent& Continent::operator=(Continent&& other) noexcept = default;
+
+Continent::~Continent() = default;
 
 // --- GETTERS ---
-std::string Continent::getName() const {
-  return *name;
+const std::string& Continent::getName() const {
+  return name;
 }
 
 int Continent::getId() const {
-  return *id;
+  return id;
 }
 
 int Continent::getBonus() const {
-  return *bonus;
+  return bonus;
 }
 
 const std::vector<Territory*>& Continent::getTerritories() const {
-  return *territories;
+  return territories;
 }
 
 // --- SETTERS ---
 void Continent::setName(const std::string& newName) {
-  *name = newName;
+  name = newName;
 }
 
 void Continent::setId(int newId) {
-  *id = newId;
+  id = newId;
 }
 
 void Continent::setBonus(int newBonus) {
-  *bonus = newBonus;
+  bonus = newBonus;
 }
 
 // --- MANAGEMENT ---
 bool Continent::containsTerritory(const Territory* terr) const {
-  return std::ranges::any_of(*territories, [terr](const Territory* t) {
+  return std::ranges::any_of(territories, [terr](const Territory* t) {
     return t == terr;
   });
 }
@@ -264,23 +312,23 @@ void Continent::addTerritory(Territory* terr) {
   // ensure no duplicates
   if (!terr || containsTerritory(terr)) return;
 
-  territories->push_back(terr);
+  territories.push_back(terr);
   terr->setContinent(this); // assign the territory to the current continent
 }
 
 void Continent::removeTerritory(Territory* terr) {
   if (terr) terr->setContinent(nullptr);
-  std::erase(*territories, terr);
+  std::erase(territories, terr);
 }
 
 // --- VALIDATION ---
 bool Continent::isConnected() const {
-  if (territories->empty() || territories->size() == 1) return true;
+  if (territories.empty() || territories.size() == 1) return true;
 
   // use bfs to check if all territories in a continent are connected
-  std::unordered_set visited{(*territories)[0]};
+  std::unordered_set visited{territories[0]};
   std::queue<Territory*> queue;
-  queue.push((*territories)[0]);
+  queue.push(territories[0]);
 
   while (!queue.empty()) {
     const auto terr = queue.front();
@@ -295,22 +343,20 @@ bool Continent::isConnected() const {
     }
   }
 
-  return visited.size() == territories->size();
+  return visited.size() == territories.size();
 }
 
 // --- UTILITY ---
 void Continent::displayInfo() const {
-  std::cout << "Continent: " << (name ? *name : "<Unnamed>")
-            << " (ID: " << (id ? *id : -1)
-            << ", Bonus: " << (bonus ? *bonus : 0) << ")" << std::endl;
+  std::cout << "Continent: " << name << " (ID: " << id << ", Bonus: " << bonus << ")" << std::endl;
 
-  std::cout << "  Territories (" << territories->size() << "): ";
-  if (territories->empty()) {
+  std::cout << "  Territories (" << territories.size() << "): ";
+  if (territories.empty()) {
     std::cout << "None";
   } else {
-    for (size_t i = 0; i < territories->size(); i++) {
-      std::cout << ((*territories)[i] ? (*territories)[i]->getName() : "None");
-      if (i < territories->size() - 1) {
+    for (size_t i = 0; i < territories.size(); i++) {
+      std::cout << (territories[i] ? territories[i]->getName() : "None");
+      if (i < territories.size() - 1) {
         std::cout << ", ";
       }
     }
@@ -325,13 +371,269 @@ bool Continent::operator==(const Continent& other) const {
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const Continent& cont) {
-  os << "Continent[" << (cont.name ? *cont.name : "<Unnamed>")
-     << " (ID:" << (cont.id ? *cont.id : -1) << "),"
-     << " Territories:" << cont.territories->size() << "]";
+  os << "Continent[" << cont.name << " (ID:" << cont.id << "),"
+     << " Territories:" << cont.territories.size() << "]";
   return os;
 }
 
 
+// ==================== MapDistances Class Implementation ====================
+namespace {
+  // below this many territories, starting threads costs more than the searches themselves
+  constexpr int PARALLEL_THRESHOLD = 256;
+
+  // the graph as a table depends on it: the territory count, then each territory's degree and neighbour indices
+  std::vector<std::int32_t> graphShape(const Map& map) {
+    const auto& territories = map.getTerritories();
+    std::vector<std::int32_t> shape;
+    shape.push_back(static_cast<std::int32_t>(territories.size()));
+    for (const auto& terr : territories) {
+      shape.push_back(static_cast<std::int32_t>(terr->getAdjTerritories().size()));
+      for (const Territory* adj : terr->getAdjTerritories()) shape.push_back(adj->getIndex());
+    }
+    return shape;
+  }
+
+  // FNV-1a over the shape
+  std::uint64_t graphFingerprint(const std::vector<std::int32_t>& shape) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const std::int32_t value : shape) hash = (hash ^ static_cast<std::uint32_t>(value)) * 1099511628211ull;
+    return hash;
+  }
+
+  // tables already built, keyed by graph fingerprint; a run only ever sees a handful of maps. The shape is kept
+  // with each table so a fingerprint collision is caught rather than answered with another graph's distances
+  struct CachedDistances {
+    std::vector<std::int32_t> shape;
+    std::shared_ptr<const MapDistances> table;
+  };
+
+  std::mutex distancesMutex;
+  std::unordered_map<std::uint64_t, CachedDistances> distancesCache;
+}
+
+MapDistances::MapDistances(const Map& map) :
+  count(map.getNumberOfTerritories()),
+  distances(static_cast<std::size_t>(count) * count, UNREACHABLE),
+  nextHops(static_cast<std::size_t>(count) * count, NO_HOP) {
+
+  const int threadCount = count < PARALLEL_THRESHOLD ? 1 : Parallelism::available();
+
+  // every source fills its own row, so threads never write to the same memory
+  auto searchRows = [this, &map, threadCount](int first) {
+    std::vector<int> queue;
+    queue.reserve(count);
+    for (int source = first; source < count; source += threadCount) fillFrom(source, map, queue);
+  };
+
+  if (threadCount == 1) {
+    searchRows(0);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threadCount; t++) workers.emplace_back(searchRows, t);
+  for (auto& worker : workers) worker.join();
+}
+
+// --- GETTERS ---
+int MapDistances::getTerritoryCount() const {
+  return count;
+}
+
+// --- QUERIES ---
+int MapDistances::distance(int from, int to) const {
+  if (from < 0 || to < 0 || from >= count || to >= count) return -1;
+
+  const std::uint8_t hops = distances[static_cast<std::size_t>(from) * count + to];
+  return hops == UNREACHABLE ? -1 : hops;
+}
+
+int MapDistances::nextHop(int from, int to) const {
+  if (from < 0 || to < 0 || from >= count || to >= count) return -1;
+
+  const std::uint16_t hop = nextHops[static_cast<std::size_t>(from) * count + to];
+  return hop == NO_HOP ? -1 : hop;
+}
+
+// --- FACTORY ---
+std::shared_ptr<const MapDistances> MapDistances::forMap(const Map& map) {
+  std::vector<std::int32_t> shape = graphShape(map);
+  const std::uint64_t key = graphFingerprint(shape);
+  {
+    std::lock_guard lock(distancesMutex);
+    const auto it = distancesCache.find(key);
+    if (it != distancesCache.end() && it->second.shape == shape) return it->second.table;
+  }
+
+  // build outside the lock; if two threads race, the first table stored wins. A graph whose fingerprint is
+  // taken by a different one keeps its own table uncached
+  auto built = std::make_shared<const MapDistances>(map);
+  std::lock_guard lock(distancesMutex);
+  const auto it = distancesCache.find(key);
+  if (it == distancesCache.end()) {
+    distancesCache.emplace(key, CachedDistances{std::move(shape), built});
+    return built;
+  }
+  return it->second.shape == shape ? it->second.table : built;
+}
+
+// --- HELPERS ---
+void MapDistances::fillFrom(int source, const Map& map, std::vector<int>& queue) {
+  const auto& territories = map.getTerritories();
+  std::uint8_t* dist = distances.data() + static_cast<std::size_t>(source) * count;
+  std::uint16_t* hop = nextHops.data() + static_cast<std::size_t>(source) * count;
+
+  queue.clear();
+  queue.push_back(source);
+  dist[source] = 0;
+
+  for (std::size_t head = 0; head < queue.size(); head++) {
+    const int current = queue[head];
+
+    for (const Territory* adj : territories[current]->getAdjTerritories()) {
+      const int next = adj->getIndex();
+      if (next < 0 || next >= count || dist[next] != UNREACHABLE) continue;
+
+      dist[next] = static_cast<std::uint8_t>(std::min(dist[current] + 1, UNREACHABLE - 1));
+      hop[next] = static_cast<std::uint16_t>(current == source ? next : hop[current]);
+      queue.push_back(next);
+    }
+  }
+}
+
+
+// ==================== TallyKernels Class Implementation ====================
+namespace {
+  // players are tallied in groups of this many, one pair of vector accumulators each
+  constexpr int TALLY_GROUP = 8;
+
+  void tallySlotsScalar(const std::int32_t* owners, const std::int32_t* armies, int from, int count,
+                        std::span<const std::int32_t> slots, PlayerTally* out) {
+    for (int i = from; i < count; i++) {
+      for (std::size_t p = 0; p < slots.size(); p++) {
+        if (owners[i] == slots[p]) {
+          out[p].territories++;
+          out[p].armies += armies[i];
+        }
+      }
+    }
+  }
+
+  // slot owning every member, -1 when the members are split (or unowned)
+  std::int32_t sharedOwnerScalar(const std::int32_t* owners, const std::int32_t* members, int from, int count,
+                                 std::int32_t owner) {
+    for (int i = from; i < count; i++) {
+      if (owners[members[i]] != owner) return -1;
+    }
+    return owner;
+  }
+
+#ifdef RISK_AVX2_KERNELS
+  __attribute__((target("avx2")))
+  std::int32_t horizontalSum(__m256i v) {
+    const __m128i half = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    const __m128i quad = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtsi128_si32(_mm_add_epi32(quad, _mm_shuffle_epi32(quad, _MM_SHUFFLE(2, 3, 0, 1))));
+  }
+
+  // eight territories per step: compare the owner lanes against each slot, count matches and mask in their armies
+  __attribute__((target("avx2")))
+  void tallySlotsAvx2(const std::int32_t* owners, const std::int32_t* armies, int count,
+                      std::span<const std::int32_t> slots, PlayerTally* out) {
+    const int vectorEnd = count - count % 8;
+
+    for (std::size_t base = 0; base < slots.size(); base += TALLY_GROUP) {
+      const int group = static_cast<int>(std::min<std::size_t>(TALLY_GROUP, slots.size() - base));
+      __m256i slot[TALLY_GROUP], counted[TALLY_GROUP], summed[TALLY_GROUP];
+      for (int p = 0; p < group; p++) {
+        slot[p] = _mm256_set1_epi32(slots[base + p]);
+        counted[p] = _mm256_setzero_si256();
+        summed[p] = _mm256_setzero_si256();
+      }
+
+      for (int i = 0; i < vectorEnd; i += 8) {
+        const __m256i own = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(owners + i));
+        const __m256i arm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(armies + i));
+        for (int p = 0; p < group; p++) {
+          const __m256i match = _mm256_cmpeq_epi32(own, slot[p]); // all ones where owned, i.e. -1
+          counted[p] = _mm256_sub_epi32(counted[p], match);
+          summed[p] = _mm256_add_epi32(summed[p], _mm256_and_si256(match, arm));
+        }
+      }
+
+      for (int p = 0; p < group; p++) {
+        out[base + p].territories += horizontalSum(counted[p]);
+        out[base + p].armies += horizontalSum(summed[p]);
+      }
+    }
+
+    tallySlotsScalar(owners, armies, vectorEnd, count, slots, out);
+  }
+
+  __attribute__((target("avx2")))
+  std::int32_t sharedOwnerAvx2(const std::int32_t* owners, const std::int32_t* members, int count, std::int32_t owner) {
+    const int vectorEnd = count - count % 8;
+    const __m256i expected = _mm256_set1_epi32(owner);
+
+    for (int i = 0; i < vectorEnd; i += 8) {
+      const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(members + i));
+      const __m256i own = _mm256_i32gather_epi32(owners, idx, 4);
+      if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(own, expected)) != -1) return -1;
+    }
+    return sharedOwnerScalar(owners, members, vectorEnd, count, owner);
+  }
+#endif
+}
+
+// --- QUERIES ---
+bool TallyKernels::hasAvx2() {
+#ifdef RISK_AVX2_KERNELS
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+#else
+  return false;
+#endif
+}
+
+// --- KERNELS ---
+void TallyKernels::tally(const std::int32_t* owners, const std::int32_t* armies, int count,
+                         std::span<const std::int32_t> slots, PlayerTally* out) {
+  if (hasAvx2()) return tallyAvx2(owners, armies, count, slots, out);
+  tallyScalar(owners, armies, count, slots, out);
+}
+
+void TallyKernels::tallyScalar(const std::int32_t* owners, const std::int32_t* armies, int count,
+                               std::span<const std::int32_t> slots, PlayerTally* out) {
+  tallySlotsScalar(owners, armies, 0, count, slots, out);
+}
+
+void TallyKernels::tallyAvx2(const std::int32_t* owners, const std::int32_t* armies, int count,
+                             std::span<const std::int32_t> slots, PlayerTally* out) {
+#ifdef RISK_AVX2_KERNELS
+  if (hasAvx2()) return tallySlotsAvx2(owners, armies, count, slots, out);
+#endif
+  tallyScalar(owners, armies, count, slots, out);
+}
+
+std::int32_t TallyKernels::commonOwner(const std::int32_t* owners, const std::int32_t* members, int count) {
+  return hasAvx2() ? commonOwnerAvx2(owners, members, count) : commonOwnerScalar(owners, members, count);
+}
+
+std::int32_t TallyKernels::commonOwnerScalar(const std::int32_t* owners, const std::int32_t* members, int count) {
+  if (count == 0 || owners[members[0]] < 0) return -1;
+  return sharedOwnerScalar(owners, members, 0, count, owners[members[0]]);
+}
+
+std::int32_t TallyKernels::commonOwnerAvx2(const std::int32_t* owners, const std::int32_t* members, int count) {
+  if (count == 0 || owners[members[0]] < 0) return -1;
+#ifdef RISK_AVX2_KERNELS
+  if (hasAvx2()) return sharedOwnerAvx2(owners, members, count, owners[members[0]]);
+#endif
+  return sharedOwnerScalar(owners, members, 0, count, owners[members[0]]);
+}
+
+
 // ==================== Map Class Implementation ====================
 Map::Map() :
   name(new std::string("Warzone")),
@@ -355,11 +657,13 @@ Map::Map(const Map& other) :
   continents(new std::vector<std::unique_ptr<Continent>>()),
   territoryNameMap(new std::unordered_map<std::string, Territory*>()),
   territoryIdMap(new std::unordered_map<int, Territory*>()),
-  continentNameMap(new std::unordered_map<std::string, Continent*>()) {
+  continentNameMap(new std::unordered_map<std::string, Continent*>()),
+  stateVersion(other.stateVersion) {
 
   // deep copy territories
   for (const auto& terr : *other.territories) {
     auto newTerr = std::make_unique<Territory>(*terr);
+    newTerr->setMap(this);
     territories->push_back(std::move(newTerr));
   }
 
@@ -387,11 +691,12 @@ Map::Map(const Map& other) :
     for (const Territory* adj : oldTerr->getAdjTerritories()) {
       Territory* newAdjTerr = (*territoryNameMap)[adj->getName()];
 
-      if (newAdjTerr && !newTerr->isAdjacentTo(newAdjTerr)) {
-        newTerr->addAdjTerritory(newAdjTerr);
-      }
+      if (newAdjTerr) newTerr->addAdjTerritory(newAdjTerr);
     }
   }
+
+  // same graph, so the same distances
+  distances = other.distances;
 }
 
 Map& Map::operator=(const Map& other) {
@@ -407,7 +712,11 @@ Map& Map::operator=(const Map& other) {
     territories = new std::vector<std::unique_ptr<Territory>>();
     for (const auto& terr : *other.territories) {
       territories->push_back(std::make_unique<Territory>(*terr));
+      territories->back()->setMap(this);
     }
+    distances = other.distances;
+    stateVersion = other.stateVersion; // the copied territories keep their change stamps
+    resetLayout();
 
     continents = new std::vector<std::unique_ptr<Continent>>();
     for (const auto& cont : *other.continents) {
@@ -431,7 +740,7 @@ Map::~Map() {
 }
 
 // --- GETTERS ---
-std::string Map::getName() const {
+const std::string& Map::getName() const {
   return *name;
 }
 
@@ -448,10 +757,18 @@ void Map::setName(const std::string& newName) const {
   *name = newName;
 }
 
+void Map::setOwnershipListener(OwnershipListener* listener) {
+  ownershipListener = listener;
+}
+
 // --- TERRITORY MANAGEMENT ---
 Territory* Map::addTerritory(const std::string& terrName, int id) {
   auto territory = std::make_unique<Territory>(terrName, id);
+  territory->setIndex(static_cast<int>(territories->size()));
+  territory->setMap(this);
   territories->push_back(std::move(territory));
+  resetDistances();
+  resetLayout();
 
   Territory* territoryPtr = territories->back().get();
   (*territoryNameMap)[terrName] = territoryPtr;
@@ -493,6 +810,10 @@ bool Map::removeTerritory(const std::string& terrName) {
     return t.get() == territory;
   });
 
+  // keep indices dense, shifting down preserves every neighbour list's order
+  for (size_t i = 0; i < territories->size(); i++) (*territories)[i]->setIndex(static_cast<int>(i));
+  resetDistances();
+
   return true;
 }
 
@@ -503,6 +824,7 @@ Continent* Map::addContinent(const std::string& contName, int id, int bonus) {
 
   Continent* continentPtr = continents->back().get();
   (*continentNameMap)[contName] = continentPtr;
+  resetLayout();
 
   return continentPtr;
 }
@@ -528,6 +850,7 @@ bool Map::removeContinent(const std::string& contName) {
   std::erase_if(*continents, [continent](const std::unique_ptr<Continent>& c) {
     return c.get() == continent;
   });
+  resetLayout();
 
   return true;
 }
@@ -550,6 +873,74 @@ void Map::addAdjacency(Territory* terr1, Territory* terr2) {
   }
 }
 
+const MapDistances& Map::getDistances() const {
+  if (!distances) distances = MapDistances::forMap(*this);
+  return *distances;
+}
+
+int Map::distanceBetween(const Territory* from, const Territory* to) const {
+  if (!from || !to || from->getMap() != this || to->getMap() != this) return -1;
+  return getDistances().distance(from->getIndex(), to->getIndex());
+}
+
+Territory* Map::nextHopTowards(const Territory* from, const Territory* to) const {
+  if (!from || !to || from->getMap() != this || to->getMap() != this) return nullptr;
+
+  const int hop = getDistances().nextHop(from->getIndex(), to->getIndex());
+  return hop >= 0 ? (*territories)[hop].get() : nullptr;
+}
+
+void Map::resetDistances() {
+  distances.reset();
+}
+
+// --- ARMY STATISTICS ---
+MapTally Map::tally(std::span<const Player* const> players) const {
+  if (layoutStale) rebuildLayout();
+
+  MapTally result;
+  result.players.resize(players.size());
+
+  std::vector<std::int32_t> slots;
+  slots.reserve(players.size());
+  for (const Player* play : players) slots.push_back(play ? play->getSlot() : -1);
+
+  TallyKernels::tally(ownerSlots.data(), armyCounts.data(), static_cast<int>(ownerSlots.size()), slots, result.players.data());
+
+  // a continent counts for whoever owns every one of its territories
+  result.continentOwners.assign(continents->size(), -1);
+  for (std::size_t c = 0; c < continents->size(); c++) {
+    const std::int32_t* members = continentMembers.data() + continentOffsets[c];
+    const std::int32_t owner = TallyKernels::commonOwner(ownerSlots.data(), members, continentOffsets[c + 1] - continentOffsets[c]);
+    if (owner < 0) continue;
+
+    const auto it = std::ranges::find(slots, owner);
+    if (it == slots.end()) continue;
+
+    const auto pos = static_cast<int>(it - slots.begin());
+    result.continentOwners[c] = pos;
+    result.players[pos].continentBonus += (*continents)[c]->getBonus();
+  }
+
+  return result;
+}
+
+void Map::syncOwner(int index, const Player* owner) {
+  if (!layoutStale && index >= 0 && index < ownerSlots.size()) ownerSlots[index] = owner ? owner->getSlot() : -1;
+}
+
+void Map::syncArmies(int index, int armies) {
+  if (!layoutStale && index >= 0 && index < armyCounts.size()) armyCounts[index] = armies;
+}
+
+void Map::resetLayout() {
+  layoutStale = true;
+}
+
+void Map::notifyOwnerChanged(Territory* terr, Player* oldOwner) {
+  if (ownershipListener) ownershipListener->ownerChanged(terr, oldOwner);
+}
+
 // --- VALIDATION ---
 bool Map::validate() const {
   return isConnectedGraph() && areContinentsConnected() && eachTerritoryBelongsToOneContinent();
@@ -650,6 +1041,8 @@ void Map::displayMap() const {
 }
 
 void Map::clear() {
+  distances.reset();
+  resetLayout();
   territories->clear();
   continents->clear();
   territoryNameMap->clear();
@@ -665,7 +1058,36 @@ int Map::getNumberOfContinents() const {
   return continents->size();
 }
 
+// --- STATE VERSIONING ---
+std::uint64_t Map::getStateVersion() const {
+  return stateVersion;
+}
+
+void Map::bumpStateVersion() {
+  stateVersion++;
+}
+
 // --- HELPERS ---
+void Map::rebuildLayout() const {
+  armyCounts.clear();
+  ownerSlots.clear();
+  for (const auto& terr : *territories) {
+    armyCounts.push_back(terr->getArmies());
+    ownerSlots.push_back(terr->getOwner() ? terr->getOwner()->getSlot() : -1);
+  }
+
+  continentOffsets.assign(1, 0);
+  continentMembers.clear();
+  for (const auto& cont : *continents) {
+    for (const Territory* terr : cont->getTerritories()) {
+      if (terr->getMap() == this) continentMembers.push_back(terr->getIndex());
+    }
+    continentOffsets.push_back(static_cast<std::int32_t>(continentMembers.size()));
+  }
+
+  layoutStale = false;
+}
+
 void Map::rebuildMaps() {
   territoryNameMap->clear();
   territoryIdMap->clear();
@@ -861,7 +1283,7 @@ bool MapLoader::parseContinentSection(Map* map, const std::string& line) {
     return false;
   }
 
-  static int continentId = 1;
+  static std::atomic<int> continentId = 1;
   map->addContinent(continentName, continentId++, bonus);
   return true;
 }
@@ -887,7 +1309,7 @@ bool MapLoader::parseTerritorySection(Map* map, const std::string& line) {
   // get or create territory
   Territory* territory = map->getTerritory(territoryName);
   if (!territory) {
-    static int territoryId = 1;
+    static std::atomic<int> territoryId = 1;
     territory = map->addTerritory(territoryName, territoryId++);
   }
 
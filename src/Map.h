@@ -1,5 +1,8 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -7,40 +10,52 @@
 
 class Player;
 class Continent;
+class Map;
 
 /**
  * The Territory class represents a node in the map graph.
  */
 class Territory {
 private:
-  std::string* name;
-  int* id;
-  Player* owner;                           // player who owns this territory
-  int* armies;                             // armies owned by the player
-  std::vector<Territory*>* adjTerritories;
-  Continent* continent;                    // the continent which the territory belongs to
+  std::string name;
+  int id;
+  int index;                              // position in the owning map, -1 outside of a map
+  Player* owner;                          // player who owns this territory
+  int armies;                             // armies owned by the player
+  std::uint64_t changedAt;                // map state version of the last owner or army change
+  std::vector<Territory*> adjTerritories;
+  std::vector<Territory*> adjByIndex;     // adjTerritories sorted by index, for binary search lookups
+  Continent* continent;                   // the continent which the territory belongs to
+  Map* map;                               // the map holding this territory, nullptr outside of a map
 
 public:
   Territory();
   Territory(const std::string& name, int id);
   Territory(const Territory& other); // copy constructor
+  Territory(Territory&& other) noexcept; // move constructor
   Territory& operator=(const Territory& other); // assignment operator
+  Territory& operator=(Territory&& other) noexcept; // move assignment operator
   ~Territory(); // destructor
 
   // getters
-  std::string getName() const;
+  const std::string& getName() const;
   int getId() const;
+  int getIndex() const;
   Player* getOwner() const;
   int getArmies() const;
+  std::uint64_t getChangedAt() const;
   const std::vector<Territory*>& getAdjTerritories() const;
   Continent* getContinent() const;
+  Map* getMap() const;
 
   // setters
   void setName(const std::string& newName);
   void setId(int newId);
+  void setIndex(int newIndex); // must keep the relative order of territories that already have neighbours
   void setOwner(Player* newOwner);
   void setArmies(int newArmies);
   void setContinent(Continent* newContinent);
+  void setMap(Map* newMap);
 
   // management
   bool isAdjacentTo(const Territory* terr) const;
@@ -53,6 +68,10 @@ public:
 
   // stream insertion operator
   friend std::ostream& operator<<(std::ostream& os, const Territory& terr);
+
+private:
+  // helpers
+  void stampChange(); // moves the map's state version on and records it here
 };
 
 
@@ -61,20 +80,22 @@ public:
  */
 class Continent {
 private:
-  std::string* name;
-  int* id;
-  int* bonus;
-  std::vector<Territory*>* territories; // territories within this continent
+  std::string name;
+  int id;
+  int bonus;
+  std::vector<Territory*> territories; // territories within this continent
 
 public:
   Continent();
   Continent(const std::string& name, int id, int bonus);
   Continent(const Continent& other); // copy constructor
+  Continent(Continent&& other) noexcept; // move constructor
   Continent& operator=(const Continent& other); // assignment operator
+  Continent& operator=(Continent&& other) noexcept; // move assignment operator
   ~Continent(); // destructor
 
   // getters
-  std::string getName() const;
+  const std::string& getName() const;
   int getId() const;
   int getBonus() const;
   const std::vector<Territory*>& getTerritories() const;
@@ -101,6 +122,91 @@ public:
 };
 
 
+/**
+ * All-pairs hop distances and first steps over a map graph, indexed by territory index.
+ * Built with one BFS per source spread across threads, then shared read-only by every map with the same graph.
+ */
+class MapDistances {
+public:
+  static constexpr std::uint8_t UNREACHABLE = 0xFF; // distances of 254 hops or more are stored as 254
+  static constexpr std::uint16_t NO_HOP = 0xFFFF;
+
+private:
+  int count;
+  std::vector<std::uint8_t> distances; // count x count
+  std::vector<std::uint16_t> nextHops; // count x count, first territory on a shortest path
+
+public:
+  explicit MapDistances(const Map& map);
+
+  // getters
+  int getTerritoryCount() const;
+
+  // queries
+  int distance(int from, int to) const; // -1 when unreachable
+  int nextHop(int from, int to) const;  // -1 when unreachable or from == to
+
+  // factory
+  static std::shared_ptr<const MapDistances> forMap(const Map& map); // reuses the table of an identical graph
+
+private:
+  // helpers
+  void fillFrom(int source, const Map& map, std::vector<int>& queue);
+};
+
+
+/**
+ * Receives every ownership change on a map as it happens.
+ */
+class OwnershipListener {
+public:
+  virtual ~OwnershipListener() = default; // destructor
+
+  // management
+  virtual void ownerChanged(Territory* terr, Player* oldOwner) = 0; // terr->getOwner() is the new owner
+};
+
+
+/**
+ * Per-player figures gathered in one pass over a map's dense army and owner arrays.
+ */
+struct PlayerTally {
+  int territories = 0;
+  int armies = 0;
+  int continentBonus = 0; // sum of the bonuses of every continent the player holds entirely
+};
+
+struct MapTally {
+  std::vector<PlayerTally> players; // in the order the players were given
+  std::vector<int> continentOwners; // per continent, position of the player holding all of it, -1 otherwise
+};
+
+
+/**
+ * The scans behind Map::tally, over the dense owner and army arrays. Each has a portable scalar form; x86 gcc/clang
+ * builds also carry avx2 forms, which tally and commonOwner pick at runtime when the cpu supports them. The avx2
+ * forms fall back to the scalar ones elsewhere, and both always give the same answers.
+ */
+class TallyKernels {
+public:
+  // queries
+  static bool hasAvx2(); // compiled in and supported by this cpu
+
+  // kernels: out[p] gains the territories owned by slots[p] and their armies
+  static void tally(const std::int32_t* owners, const std::int32_t* armies, int count,
+                    std::span<const std::int32_t> slots, PlayerTally* out);
+  static void tallyScalar(const std::int32_t* owners, const std::int32_t* armies, int count,
+                          std::span<const std::int32_t> slots, PlayerTally* out);
+  static void tallyAvx2(const std::int32_t* owners, const std::int32_t* armies, int count,
+                        std::span<const std::int32_t> slots, PlayerTally* out);
+
+  // kernels: the slot owning every member territory, -1 when they are split or unowned
+  static std::int32_t commonOwner(const std::int32_t* owners, const std::int32_t* members, int count);
+  static std::int32_t commonOwnerScalar(const std::int32_t* owners, const std::int32_t* members, int count);
+  static std::int32_t commonOwnerAvx2(const std::int32_t* owners, const std::int32_t* members, int count);
+};
+
+
 /**
  * Map class representing the entire game map as a connected graph
  */
@@ -112,6 +218,19 @@ private:
   std::unordered_map<std::string, Territory*>* territoryNameMap;
   std::unordered_map<int, Territory*>* territoryIdMap;
   std::unordered_map<std::string, Continent*>* continentNameMap;
+  mutable std::shared_ptr<const MapDistances> distances; // built on first use
+
+  // dense mirror of territory state by territory index, rebuilt on first use after the layout changes
+  mutable std::vector<std::int32_t> armyCounts;
+  mutable std::vector<std::int32_t> ownerSlots;       // owner's player slot, -1 when unowned
+  mutable std::vector<std::int32_t> continentOffsets; // csr offsets into continentMembers
+  mutable std::vector<std::int32_t> continentMembers; // territory indices per continent
+  mutable bool layoutStale = true;
+  OwnershipListener* ownershipListener = nullptr; // non-owning, not carried over by copies
+
+  // bumped on every ownership, army or truce change in this map's game, used to invalidate cached strategy
+  // results and order checks (0 is reserved for "never computed")
+  std::uint64_t stateVersion = 1;
 
 public:
   Map();
@@ -121,12 +240,13 @@ public:
   ~Map(); // destructor
 
   // getters
-  std::string getName() const;
+  const std::string& getName() const;
   const std::vector<std::unique_ptr<Territory>>& getTerritories() const;
   const std::vector<std::unique_ptr<Continent>>& getContinents() const;
 
   // setters
   void setName(const std::string& newName) const;
+  void setOwnershipListener(OwnershipListener* listener); // nullptr detaches
 
   // territory management
   Territory* addTerritory(const std::string& terrName, int id);
@@ -142,6 +262,17 @@ public:
   // graph operations
   void addAdjacency(const std::string& terr1, const std::string& terr2);
   static void addAdjacency(Territory* terr1, Territory* terr2);
+  const MapDistances& getDistances() const;
+  int distanceBetween(const Territory* from, const Territory* to) const; // hops, -1 when unreachable
+  Territory* nextHopTowards(const Territory* from, const Territory* to) const; // nullptr when there is no path
+  void resetDistances(); // called whenever the graph changes
+
+  // army statistics
+  MapTally tally(std::span<const Player* const> players) const;
+  void syncOwner(int index, const Player* owner); // called by territories so the dense layout stays current
+  void syncArmies(int index, int armies);
+  void resetLayout(); // called whenever territories or continent membership change
+  void notifyOwnerChanged(Territory* terr, Player* oldOwner);
 
   // validation
   bool validate() const;
@@ -155,12 +286,17 @@ public:
   int getNumberOfTerritories() const;
   int getNumberOfContinents() const;
 
+  // state versioning
+  std::uint64_t getStateVersion() const;
+  void bumpStateVersion();
+
   // stream insertion operator
   friend std::ostream& operator<<(std::ostream& os, const Map& map);
 
 private:
   // helpers
   void rebuildMaps();
+  void rebuildLayout() const;
 };
 
 
@@ -206,3 +342,5 @@ private:
 
 // free function
 void testLoadMaps();
+void testTallyKernels();
+void testMapDistances();
@@ -2,9 +2,13 @@
 #include "Player.h"
 #include "Utility.h"
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -94,3 +98,151 @@ void testLoadMaps() {
   std::cout << "ALL TESTS COMPLETED" << std::endl;
   std::cout << "========================================\n" << std::endl;
 }
+
+/**
+ * Driver function to check the tally kernels against each other
+ * Random owner and army arrays of every length around the vector width, tallied for up to 20 players, and
+ * continents split at every position, must give the same answers from the scalar and avx2 kernels.
+ */
+void testTallyKernels() {
+  std::cout << "========================================" << std::endl;
+  std::cout << "   TALLY KERNEL TEST" << std::endl;
+  std::cout << "========================================" << std::endl;
+  std::cout << "AVX2 kernels: " << (TallyKernels::hasAvx2() ? "in use" : "not available, checking the fallback") << "\n";
+
+  std::mt19937 rng(42);
+  std::vector<int> lengths(41);
+  std::iota(lengths.begin(), lengths.end(), 0);
+  lengths.insert(lengths.end(), {63, 64, 65, 255, 1000});
+
+  // 1. tallies: owners are player slots 0-19 or -1 for unowned, some slots are asked for twice or own nothing
+  int tallies = 0, tallyMismatches = 0;
+  for (const int count : lengths) {
+    for (const int players : {1, 3, 8, 9, 20}) {
+      std::uniform_int_distribution<std::int32_t> owner(-1, players + 1), army(0, 100000);
+      std::vector<std::int32_t> owners(count), armies(count);
+      for (int i = 0; i < count; i++) {
+        owners[i] = owner(rng);
+        armies[i] = army(rng);
+      }
+
+      std::vector<std::int32_t> slots(players);
+      std::iota(slots.begin(), slots.end(), 0);
+      slots.back() = slots.front();
+
+      std::vector<PlayerTally> scalar(players), avx2(players);
+      TallyKernels::tallyScalar(owners.data(), armies.data(), count, slots, scalar.data());
+      TallyKernels::tallyAvx2(owners.data(), armies.data(), count, slots, avx2.data());
+      for (int p = 0; p < players; p++) {
+        if (scalar[p].territories != avx2[p].territories || scalar[p].armies != avx2[p].armies) tallyMismatches++;
+      }
+      tallies++;
+    }
+  }
+  std::cout << "\n1. Tallies compared: " << tallies << ", mismatches: " << tallyMismatches << "\n";
+
+  // 2. continents: one owner throughout, then one member changed at each position in turn
+  int continents = 0, ownerMismatches = 0, splitMissed = 0;
+  for (const int count : lengths) {
+    std::vector<std::int32_t> owners(2 * count + 1, 3), members(count);
+    for (int i = 0; i < count; i++) members[i] = 2 * i + 1; // every other territory, scattered like real continents
+
+    auto check = [&](bool split) {
+      const std::int32_t scalar = TallyKernels::commonOwnerScalar(owners.data(), members.data(), count);
+      const std::int32_t avx2 = TallyKernels::commonOwnerAvx2(owners.data(), members.data(), count);
+      if (scalar != avx2) ownerMismatches++;
+      if (split && scalar != -1) splitMissed++;
+      continents++;
+    };
+
+    check(false);
+    for (int i = 0; i < count; i++) {
+      owners[members[i]] = i == 0 ? -1 : 5; // the first member decides the owner, so make it unowned instead
+      check(true);
+      owners[members[i]] = 3;
+    }
+  }
+  std::cout << "2. Continents compared: " << continents << ", mismatches: " << ownerMismatches
+            << ", splits missed: " << splitMissed << "\n";
+
+  std::cout << "   Kernels agree: " << (tallyMismatches == 0 && ownerMismatches == 0 && splitMissed == 0 ? "YES" : "NO") << "\n";
+}
+
+/**
+ * Driver function to test the distance tables
+ * Hop distances and first steps on a small graph, every pair of a real map against a plain breadth-first
+ * search, and the table being dropped when adjacency changes and shared between copies of the same graph.
+ */
+void testMapDistances() {
+  std::cout << "========================================" << std::endl;
+  std::cout << "   MAP DISTANCES TEST" << std::endl;
+  std::cout << "========================================" << std::endl;
+
+  // 1. a line A-B-C-D and an island E
+  Map line("Line");
+  std::vector<Territory*> stops;
+  for (const char* name : {"A", "B", "C", "D", "E"}) {
+    stops.push_back(line.addTerritory(name, static_cast<int>(stops.size()) + 1));
+  }
+  for (int i = 0; i + 1 < 4; i++) Map::addAdjacency(stops[i], stops[i + 1]);
+
+  auto hopName = [](const Territory* terr) { return terr ? terr->getName() : std::string("none"); };
+  const bool lineRight =
+    line.distanceBetween(stops[0], stops[3]) == 3 && line.nextHopTowards(stops[0], stops[3]) == stops[1] &&
+    line.distanceBetween(stops[3], stops[1]) == 2 && line.nextHopTowards(stops[3], stops[1]) == stops[2] &&
+    line.distanceBetween(stops[0], stops[0]) == 0 && !line.nextHopTowards(stops[0], stops[0]) &&
+    line.distanceBetween(stops[0], stops[4]) == -1 && !line.nextHopTowards(stops[0], stops[4]);
+  std::cout << "\n1. A to D: " << line.distanceBetween(stops[0], stops[3]) << " hops via "
+            << hopName(line.nextHopTowards(stops[0], stops[3])) << ", A to E: "
+            << line.distanceBetween(stops[0], stops[4]) << " via " << hopName(line.nextHopTowards(stops[0], stops[4]))
+            << " -> " << (lineRight ? "correct" : "WRONG") << "\n";
+
+  // 2. every pair of a real map against a breadth-first search from each source
+  MapLoader loader;
+  const std::unique_ptr<Map> canada = loader.loadMap("maps/Canada/Canada.map");
+  int pairs = 0, wrong = 0;
+  if (canada) {
+    const auto& territories = canada->getTerritories();
+    for (const auto& source : territories) {
+      std::vector<int> hops(territories.size(), -1);
+      std::vector<const Territory*> queue = {source.get()};
+      hops[source->getIndex()] = 0;
+      for (std::size_t head = 0; head < queue.size(); head++) {
+        for (const Territory* adj : queue[head]->getAdjTerritories()) {
+          if (hops[adj->getIndex()] >= 0) continue;
+          hops[adj->getIndex()] = hops[queue[head]->getIndex()] + 1;
+          queue.push_back(adj);
+        }
+      }
+
+      for (const auto& target : territories) {
+        pairs++;
+        const int expected = hops[target->getIndex()];
+        const Territory* step = canada->nextHopTowards(source.get(), target.get());
+
+        // the first step must border the source and be one hop closer to the target
+        const bool stepRight = expected <= 0
+          ? step == nullptr
+          : step && source->isAdjacentTo(step) && canada->distanceBetween(step, target.get()) == expected - 1;
+        if (canada->distanceBetween(source.get(), target.get()) != expected || !stepRight) wrong++;
+      }
+    }
+  }
+  std::cout << "2. Canada: " << pairs << " pairs checked, " << wrong << " wrong\n";
+
+  // 3. copies of a graph share its table, a change of adjacency drops it
+  Map copy(line);
+  const bool shared = &copy.getDistances() == &line.getDistances();
+  Map::addAdjacency(copy.getTerritory("A"), copy.getTerritory("D"));
+  const bool shortcut = copy.distanceBetween(copy.getTerritory("A"), copy.getTerritory("D")) == 1 &&
+                        line.distanceBetween(stops[0], stops[3]) == 3;
+  copy.getTerritory("A")->removeAdjTerritory(copy.getTerritory("D"));
+  copy.getTerritory("D")->removeAdjTerritory(copy.getTerritory("A"));
+  const bool restored = copy.distanceBetween(copy.getTerritory("A"), copy.getTerritory("D")) == 3 &&
+                        &copy.getDistances() == &line.getDistances();
+  std::cout << "3. Copy shares the table: " << (shared ? "yes" : "no") << ", shortcut seen after adding A-D: "
+            << (shortcut ? "yes" : "no") << ", shared again once removed: " << (restored ? "yes" : "no") << "\n";
+
+  std::cout << "   Distances correct: "
+            << (lineRight && canada && wrong == 0 && shared && shortcut && restored ? "YES" : "NO") << "\n";
+}
@@ -1,80 +1,214 @@
 #include "Orders.h"
 #include "Map.h"
+#include "Utility.h"
 
+#include <algorithm>
 
-// initialise static negotiation records
-std::unique_ptr<std::vector<NegotiationRecord>> Order::negotiationRecords = std::make_unique<std::vector<NegotiationRecord>>();
 
-// ==================== Order Class Implementation ====================
-Order::Order():
-  Subject(),
-  type(nullptr),
-  description(nullptr),
-  effect(new std::string("")) {}
+// initialise static negotiation table
+thread_local NegotiationTable Order::negotiations;
 
-Order::Order(const Order& other) :
-  Subject(other),
-  type(new std::string(*other.type)),
-  description(new std::string(*other.description)),
-  effect(new std::string(*other.effect)) {}
+// ==================== NegotiationTable Class Implementation ====================
+// --- GETTERS ---
+const std::vector<NegotiationRecord>& NegotiationTable::getRecords() const {
+  return records;
+}
 
-Order& Order::operator=(const Order& other) {
-  if (this != &other) {
-    Subject::operator=(other);
+std::uint64_t NegotiationTable::getChangedAt() const {
+  return changedAt;
+}
+
+// --- MANAGEMENT ---
+void NegotiationTable::add(Player* player1, Player* player2) {
+  records.push_back(NegotiationRecord{player1, player2});
+  if (!player1 || !player2) return;
+
+  // a new truce can turn validated attacks invalid
+  if (Map* map = player1->getMap() ? player1->getMap() : player2->getMap()) {
+    map->bumpStateVersion();
+    changedAt = map->getStateVersion();
+  }
+
+  const int slot1 = player1->getSlot(), slot2 = player2->getSlot();
+  if (std::max(slot1, slot2) >= capacity) grow(std::max(slot1, slot2) + 1);
+
+  stamps[slot1 * capacity + slot2] = epoch;
+  stamps[slot2 * capacity + slot1] = epoch;
+}
+
+bool NegotiationTable::atTruce(const Player* player1, const Player* player2) const {
+  if (!player1 || !player2) return false;
 
-    delete type;
-    delete description;
-    delete effect;
+  const int slot1 = player1->getSlot(), slot2 = player2->getSlot();
+  if (slot1 >= capacity || slot2 >= capacity) return false;
+  return stamps[slot1 * capacity + slot2] == epoch;
+}
+
+void NegotiationTable::reset() {
+  records.clear();
 
-    // deep copy primitives
-    type = new std::string(*other.type);
-    description = new std::string(*other.description);
-    effect = new std::string(*other.effect);
+  // stamps from earlier turns no longer match; only a wrapped epoch needs them wiped
+  if (++epoch == 0) {
+    std::ranges::fill(stamps, 0);
+    epoch = 1;
+  }
+}
+
+// --- HELPERS ---
+void NegotiationTable::grow(int slots) {
+  const int newCapacity = std::max({slots, 2 * capacity, 8});
+  std::vector<std::uint32_t> grown(newCapacity * newCapacity, 0);
+
+  for (int row = 0; row < capacity; row++) {
+    std::copy_n(stamps.begin() + row * capacity, capacity, grown.begin() + row * newCapacity);
+  }
+  stamps = std::move(grown);
+  capacity = newCapacity;
+}
+
+
+// ==================== OwnershipView Class Implementation ====================
+// --- MANAGEMENT ---
+void OwnershipView::capture(std::span<Player* const> players) {
+  for (auto& bits : owned) std::ranges::fill(bits, 0);
+  captured.assign(captured.size(), false);
+
+  for (Player* player : players) {
+    const int slot = player->getSlot();
+    if (slot >= static_cast<int>(owned.size())) {
+      owned.resize(slot + 1);
+      captured.resize(slot + 1, false);
+    }
+
+    std::vector<std::uint64_t>& bits = owned[slot];
+    for (const Territory* terr : player->getTerritories()) {
+      const int index = terr->getIndex();
+      if (index < 0) continue;
+      if (index / 64 >= static_cast<int>(bits.size())) bits.resize(index / 64 + 1, 0);
+      bits[index / 64] |= std::uint64_t{1} << (index % 64);
+    }
+    captured[slot] = true;
   }
-  return *this;
 }
 
-Order::~Order() {
-  delete type;
-  delete description;
-  delete effect;
+// --- UTILITY ---
+bool OwnershipView::owns(Player* player, Territory* terr) const {
+  if (!player || !terr) return false;
+
+  const int slot = player->getSlot();
+  const int index = terr->getIndex();
+  if (index < 0 || slot >= static_cast<int>(captured.size()) || !captured[slot]) {
+    return player->ownsTerritory(terr);
+  }
+
+  const std::vector<std::uint64_t>& bits = owned[slot];
+  return index / 64 < static_cast<int>(bits.size()) && (bits[index / 64] >> (index % 64) & 1);
 }
 
+
+// ==================== Order Class Implementation ====================
+Order::Order() = default;
+
+Order::Order(const Order& other) = default;
+
+Order::Order(Order&& other) noexcept = default;
+
+Order& Order::operator=(const Order& other) = default;
+
+Order& Order::operator=(Order&& other) noexcept = default;
+
+Order::~Order() = default;
+
 // --- GETTERS ---
+std::string Order::getType() const {
+  return type.empty() ? "<Unknown>" : std::string(type);
+}
+
 std::string Order::getEffect() const {
-  return *effect;
+  return effect;
+}
+
+// --- VALIDATION ---
+bool Order::validate() {
+  return check(nullptr);
+}
+
+bool Order::validate(const OwnershipView& view) {
+  return check(&view);
+}
+
+bool Order::owns(const OwnershipView* view, Player* player, Territory* terr) {
+  if (view) return view->owns(player, terr);
+  return player && player->ownsTerritory(terr);
+}
+
+// --- MANAGEMENT ---
+void Order::execute() {
+  if (!validate()) {
+    reject();
+    return;
+  }
+  apply();
 }
 
 // --- UTILITY ---
+void Order::reject() {
+  saveEffect("Invalid " + getType() + " order. Not executed.");
+}
+
 void Order::saveEffect(const std::string& eff) {
-  *effect = eff;
+  effect = eff;
   notify();
 }
 
 std::string Order::stringToLog() const {
-  return "Order: " + (type ? *type : "<Unknown>") + ", Effect: " + (effect ? *effect : "<None>");
+  return "Order: " + getType() + ", Effect: " + effect;
 }
 
-void Order::clearNegotiationRecords() {
-  negotiationRecords->clear();
+const std::vector<NegotiationRecord>& Order::getNegotiationRecords() {
+  return negotiations.getRecords();
+}
+
+void Order::addNegotiationRecord(Player* player1, Player* player2) {
+  negotiations.add(player1, player2);
+}
+
+bool Order::atTruce(const Player* player1, const Player* player2) {
+  return negotiations.atTruce(player1, player2);
+}
+
+void Order::resetNegotiations() {
+  negotiations.reset();
+}
+
+// --- SERIALIZATION ---
+std::unique_ptr<Order> Order::fromRecord(const OrderRecord& rec) {
+  if (rec.type == ORDER_TYPES::DEPLOY) return std::make_unique<OrderDeploy>(rec.player, rec.target, rec.soldiers);
+  if (rec.type == ORDER_TYPES::ADVANCE) return std::make_unique<OrderAdvance>(rec.player, rec.source, rec.target, rec.soldiers);
+  if (rec.type == ORDER_TYPES::AIRLIFT) return std::make_unique<OrderAirlift>(rec.player, rec.source, rec.target, rec.soldiers);
+  if (rec.type == ORDER_TYPES::BOMB) return std::make_unique<OrderBomb>(rec.player, rec.target);
+  if (rec.type == ORDER_TYPES::BLOCKADE) return std::make_unique<OrderBlockade>(rec.targetPlayer, rec.player, rec.target);
+  if (rec.type == ORDER_TYPES::NEGOTIATE) return std::make_unique<OrderNegotiate>(rec.targetPlayer, rec.player);
+  if (rec.type == ORDER_TYPES::CHEAT) return std::make_unique<OrderCheat>(rec.player);
+  return nullptr;
 }
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const Order& ord) {
-  os << "Order[" << (ord.type ? *ord.type : "<Unknown>")
-     << ", Description:" << (ord.description ? *ord.description : "<Nil>") << "]";
+  os << "Order[" << ord.getType()
+     << ", Description:" << (ord.description.empty() ? "<Nil>" : ord.description) << "]";
   return os;
 }
 
 
 // ==================== OrderDeploy Class Implementation ====================
-OrderDeploy::OrderDeploy(Player* play, Territory* targ, int* sold) :
+OrderDeploy::OrderDeploy(Player* play, Territory* targ, int sold) :
   Order(),
   player(play),
   target(targ),
   soldiers(sold) {
-  type = new std::string(ORDER_TYPES::DEPLOY);
-  description = new std::string("Deploys armies to an owned specified territory.");
+  type = ORDER_TYPES::DEPLOY;
+  description = "Deploys armies to an owned specified territory.";
 }
 
 OrderDeploy::OrderDeploy(const OrderDeploy& other) :
@@ -96,39 +230,43 @@ OrderDeploy& OrderDeploy::operator=(const OrderDeploy& other) {
 OrderDeploy::~OrderDeploy() = default;
 
 // --- VALIDATION ---
-bool OrderDeploy::validate() {
-  if (player == nullptr || target == nullptr || soldiers == nullptr) return false;
-  if (!player->ownsTerritory(target) || *soldiers <= 0) return false;
+bool OrderDeploy::check(const OwnershipView* view) const {
+  if (player == nullptr || target == nullptr) return false;
+  if (!owns(view, player, target) || soldiers <= 0) return false;
   return true;
 }
 
-// --- MANAGEMENT ---
-void OrderDeploy::execute() {
-  if (!validate()) {
-    saveEffect("Invalid deploy order. Not executed.");
-    return;
-  }
+bool OrderDeploy::staleSince(std::uint64_t version) const {
+  return target && target->getChangedAt() > version;
+}
 
-  std::cout << "Executing Deploy Order: Deploying " << *soldiers << " armies to " << target->getName() << std::endl;
-  target->setArmies(target->getArmies() + *soldiers);
-  saveEffect("Deployed " + std::to_string(*soldiers) + " armies to " + target->getName() + ".");
+// --- MANAGEMENT ---
+void OrderDeploy::apply() {
+  std::cout << "Executing Deploy Order: Deploying " << soldiers << " armies to " << target->getName() << std::endl;
+  target->setArmies(target->getArmies() + soldiers);
+  saveEffect("Deployed " + std::to_string(soldiers) + " armies to " + target->getName() + ".");
 }
 
 // --- HELPERS ---
-Order* OrderDeploy::clone() const {
-  return new OrderDeploy(*this);
+std::unique_ptr<Order> OrderDeploy::clone() const {
+  return std::make_unique<OrderDeploy>(*this);
+}
+
+// --- SERIALIZATION ---
+OrderRecord OrderDeploy::toRecord() const {
+  return {ORDER_TYPES::DEPLOY, player, nullptr, nullptr, target, soldiers};
 }
 
 
 // ==================== OrderAdvance Class Implementation ====================
-OrderAdvance::OrderAdvance(Player* play, Territory* src, Territory* targ, int* sold) :
+OrderAdvance::OrderAdvance(Player* play, Territory* src, Territory* targ, int sold) :
   Order(),
   player(play),
   source(src),
   target(targ),
   soldiers(sold) {
-  type = new std::string(ORDER_TYPES::ADVANCE);
-  description = new std::string("Moves armies between territories. It can also be used to attack enemy territories.");
+  type = ORDER_TYPES::ADVANCE;
+  description = "Moves armies between territories. It can also be used to attack enemy territories.";
 }
 
 OrderAdvance::OrderAdvance(const OrderAdvance& other) :
@@ -152,60 +290,56 @@ OrderAdvance& OrderAdvance::operator=(const OrderAdvance& other) {
 OrderAdvance::~OrderAdvance() = default;
 
 // --- VALIDATION ---
-bool OrderAdvance::validate() {
+bool OrderAdvance::check(const OwnershipView* view) const {
   if (
     source && target && source->isAdjacentTo(target) &&
-    player->ownsTerritory(source) && *soldiers > 0 && source->getArmies() - 1 >= *soldiers
+    owns(view, player, source) && soldiers > 0 && source->getArmies() - 1 >= soldiers
   ) {
     Player* targetPlayer = target->getOwner();
 
     // check for negotiation
-    for (const auto& record : *(this->negotiationRecords)) {
-      if (
-        (record.player1 == player && record.player2 == targetPlayer) ||
-        (record.player1 == targetPlayer && record.player2 == player)
-      ) {
-        std::cout << "Advance Order Validation Failed: Negotiation exists between " << player->getName()
-                  << " and " << targetPlayer->getName() << ". Cannot attack." << std::endl;
-        return false; // negotiation exists, cannot attack
-      }
+    if (atTruce(player, targetPlayer)) {
+      std::cout << "Advance Order Validation Failed: Negotiation exists between " << player->getName()
+                << " and " << targetPlayer->getName() << ". Cannot attack." << std::endl;
+      return false; // negotiation exists, cannot attack
     }
-
-    saveEffect("Invalid advance order. Not executed.");
     return true;
   }
 
   return false;
 }
 
+bool OrderAdvance::staleSince(std::uint64_t version) const {
+  return (source && source->getChangedAt() > version) || (target && target->getChangedAt() > version) ||
+         negotiations.getChangedAt() > version;
+}
+
 // --- MANAGEMENT ---
-void OrderAdvance::execute() {
-  if (!validate()) {
-    saveEffect("Invalid advance order. Not executed.");
-    return;
-  }
-  std::cout << "Executing Advance Order: Moving " << *soldiers << " armies from " 
+void OrderAdvance::apply() {
+  std::cout << "Executing Advance Order: Moving " << soldiers << " armies from " 
             << source->getName() << " to " << target->getName() << ".\n";
   
   if (player->ownsTerritory(target)){
-    source->setArmies(source->getArmies() - *soldiers);
-    target->setArmies(target->getArmies() + *soldiers);
+    source->setArmies(source->getArmies() - soldiers);
+    target->setArmies(target->getArmies() + soldiers);
     saveEffect("Advanced armies to friendly territory " + target->getName() + ".");
   } else {
     target->getOwner()->setGotAttackedThisTurn(true);
     // remove soldiers from source territory
-    source->setArmies(source->getArmies() - *soldiers);
+    source->setArmies(source->getArmies() - soldiers);
 
-    int attackers = *soldiers;
+    int attackers = soldiers;
     int defenders = target->getArmies();
     int attackSuccesses = 0, defenseSuccesses = 0;
+    std::uniform_int_distribution<int> roll(0, 99);
+    std::mt19937& rng = GameRandom::get();
 
-    for (int i = 0; i < *soldiers; i++) {
-      if ((rand() % 100) < 60) attackSuccesses++;
+    for (int i = 0; i < soldiers; i++) {
+      if (roll(rng) < 60) attackSuccesses++;
     }
 
     for (int i = 0; i < target->getArmies(); i++) {
-      if (rand() % 100 < 70) defenseSuccesses++;
+      if (roll(rng) < 70) defenseSuccesses++;
     }
 
     attackers -= defenseSuccesses;
@@ -231,20 +365,25 @@ void OrderAdvance::execute() {
 }
 
 // --- HELPERS ---
-Order* OrderAdvance::clone() const { 
-  return new OrderAdvance(*this); 
+std::unique_ptr<Order> OrderAdvance::clone() const {
+  return std::make_unique<OrderAdvance>(*this);
+}
+
+// --- SERIALIZATION ---
+OrderRecord OrderAdvance::toRecord() const {
+  return {ORDER_TYPES::ADVANCE, player, nullptr, source, target, soldiers};
 }
 
 
 // ==================== OrderAirlift Class Implementation ====================
-OrderAirlift::OrderAirlift(Player* play, Territory* src, Territory* targ, int* sold) :
+OrderAirlift::OrderAirlift(Player* play, Territory* src, Territory* targ, int sold) :
   Order(),
   player(play),
   source(src),
   target(targ),
   soldiers(sold) {
-  type = new std::string(ORDER_TYPES::AIRLIFT);
-  description = new std::string("Moves armies between owned territories. It can only be used once per game.");
+  type = ORDER_TYPES::AIRLIFT;
+  description = "Moves armies between owned territories. It can only be used once per game.";
 }
 
 OrderAirlift::OrderAirlift(const OrderAirlift& other) :
@@ -268,29 +407,29 @@ OrderAirlift& OrderAirlift::operator=(const OrderAirlift& other) {
 OrderAirlift::~OrderAirlift() = default;
 
 // --- VALIDATION ---
-bool OrderAirlift::validate() {
-  if (
-    source && target && player->ownsTerritory(source) &&
-    player->ownsTerritory(target) && *soldiers > 0 && source->getArmies() >= *soldiers
-  ) return true;
+bool OrderAirlift::check(const OwnershipView* view) const {
+  return source && target && owns(view, player, source) &&
+         owns(view, player, target) && soldiers > 0 && source->getArmies() >= soldiers;
+}
 
-  saveEffect("Invalid airlift order. Not executed.");
-  return false;
+bool OrderAirlift::staleSince(std::uint64_t version) const {
+  return (source && source->getChangedAt() > version) || (target && target->getChangedAt() > version);
 }
 
-void OrderAirlift::execute() {
-  if (!validate()){
-    saveEffect("Invalid airlift order. Not executed.");
-    return;
-  }
+// --- MANAGEMENT ---
+void OrderAirlift::apply() {
+  source->setArmies(source->getArmies() - soldiers);
+  target->setArmies(target->getArmies() + soldiers);
+  saveEffect("Airlifted " + std::to_string(soldiers) + " armies to " + target->getName() + ".");
+}
 
-  source->setArmies(source->getArmies() - *soldiers);
-  target->setArmies(target->getArmies() + *soldiers);
-  saveEffect("Airlifted " + std::to_string(*soldiers) + " armies to " + target->getName() + ".");
+std::unique_ptr<Order> OrderAirlift::clone() const {
+  return std::make_unique<OrderAirlift>(*this);
 }
 
-Order* OrderAirlift::clone() const {
-  return new OrderAirlift(*this);
+// --- SERIALIZATION ---
+OrderRecord OrderAirlift::toRecord() const {
+  return {ORDER_TYPES::AIRLIFT, player, nullptr, source, target, soldiers};
 }
 
 
@@ -299,8 +438,8 @@ OrderBomb::OrderBomb(Player* play, Territory* targ) :
   Order(),
   player(play),
   target(targ) {
-  type = new std::string(ORDER_TYPES::BOMB);
-  description = new std::string("Destroys half the armies on an enemy territory. It can only be used once per game.");
+  type = ORDER_TYPES::BOMB;
+  description = "Destroys half the armies on an enemy territory. It can only be used once per game.";
 }
 
 OrderBomb::OrderBomb(const OrderBomb& other) :
@@ -320,32 +459,33 @@ OrderBomb& OrderBomb::operator=(const OrderBomb& other) {
 OrderBomb::~OrderBomb() = default;
 
 // --- VALIDATION ---
-bool OrderBomb::validate() {
-  if (target && !player->ownsTerritory(target)) {
+bool OrderBomb::check(const OwnershipView* view) const {
+  if (target && !owns(view, player, target) && !atTruce(player, target->getOwner())) {
     for (auto& terr : player->getTerritories()) {
       if (terr->isAdjacentTo(target)) return true;
     }
-    return false;
   }
-
-  saveEffect("Invalid bomb order. Not executed.");
   return false;
 }
 
-// --- MANAGEMENT ---
-void OrderBomb::execute() {
-  if (!validate()) {
-    saveEffect("Invalid bomb order. Not executed.");
-    return;
-  }
+bool OrderBomb::staleSince(std::uint64_t version) const {
+  return true; // depends on every territory bordering the target, cheaper to check again
+}
 
+// --- MANAGEMENT ---
+void OrderBomb::apply() {
   target->setArmies(target->getArmies() / 2);
   saveEffect("Bombed " + target->getName() + "; armies halved.");
 }
 
 // --- HELPERS ---
-Order* OrderBomb::clone() const { 
-  return new OrderBomb(*this); 
+std::unique_ptr<Order> OrderBomb::clone() const {
+  return std::make_unique<OrderBomb>(*this);
+}
+
+// --- SERIALIZATION ---
+OrderRecord OrderBomb::toRecord() const {
+  return {ORDER_TYPES::BOMB, player, nullptr, nullptr, target, 0};
 }
 
 
@@ -355,8 +495,8 @@ OrderBlockade::OrderBlockade(Player* nPlay, Player* play, Territory* targ) :
   nPlayer(nPlay),
   player(play),
   target(targ) {
-  type = new std::string(ORDER_TYPES::BLOCKADE);
-  description = new std::string("Triples the armies in an owned territory and makes it neutral. It can only be used once per game.");
+  type = ORDER_TYPES::BLOCKADE;
+  description = "Triples the armies in an owned territory and makes it neutral. It can only be used once per game.";
 }
 
 OrderBlockade::OrderBlockade(const OrderBlockade& other) :
@@ -378,19 +518,16 @@ OrderBlockade& OrderBlockade::operator=(const OrderBlockade& other) {
 OrderBlockade::~OrderBlockade() = default;
 
 // --- VALIDATION ---
-bool OrderBlockade::validate() { 
-  if (target && player->ownsTerritory(target)) return true;
-  saveEffect("Invalid blockade order. Not executed.");
-  return false;
+bool OrderBlockade::check(const OwnershipView* view) const {
+  return target && owns(view, player, target);
 }
 
-// --- MANAGEMENT ---
-void OrderBlockade::execute() {
-  if (!validate()) {
-    saveEffect("Invalid blockade order. Not executed.");
-    return;
-  }
+bool OrderBlockade::staleSince(std::uint64_t version) const {
+  return target && target->getChangedAt() > version;
+}
 
+// --- MANAGEMENT ---
+void OrderBlockade::apply() {
   target->setArmies(target->getArmies() * 2);
   player->removeTerritory(target);
   nPlayer->addTerritory(target);
@@ -398,8 +535,13 @@ void OrderBlockade::execute() {
 }
 
 // --- HELPERS ---
-Order* OrderBlockade::clone() const { 
-  return new OrderBlockade(*this); 
+std::unique_ptr<Order> OrderBlockade::clone() const {
+  return std::make_unique<OrderBlockade>(*this);
+}
+
+// --- SERIALIZATION ---
+OrderRecord OrderBlockade::toRecord() const {
+  return {ORDER_TYPES::BLOCKADE, player, nPlayer, nullptr, target, 0};
 }
 
 
@@ -408,8 +550,8 @@ OrderNegotiate::OrderNegotiate(Player* tPlay, Player* play) :
   Order(),
   tPlayer(tPlay),
   player(play) {
-  type = new std::string(ORDER_TYPES::NEGOTIATE);
-  description = new std::string("Prevents attacks between you and another player until your next turn. It can only be used once per game.");
+  type = ORDER_TYPES::NEGOTIATE;
+  description = "Prevents attacks between you and another player until your next turn. It can only be used once per game.";
 }
 
 OrderNegotiate::OrderNegotiate(const OrderNegotiate& other) :
@@ -429,26 +571,28 @@ OrderNegotiate& OrderNegotiate::operator=(const OrderNegotiate& other) {
 OrderNegotiate::~OrderNegotiate() = default;
 
 // --- VALIDATION ---
-bool OrderNegotiate::validate() { 
-  if (tPlayer && tPlayer != player) return true;
-  saveEffect("Invalid negotiate order. Not executed.");
-  return false;
+bool OrderNegotiate::check(const OwnershipView* view) const {
+  return tPlayer && tPlayer != player;
 }
 
-// --- MANAGEMENT ---
-void OrderNegotiate::execute() {
-  if (!validate()) {
-    saveEffect("Invalid negotiate order. Not executed.");
-    return;
-  }
+bool OrderNegotiate::staleSince(std::uint64_t version) const {
+  return false; // only depends on who the order names
+}
 
-  this->negotiationRecords->push_back(NegotiationRecord{player, tPlayer});
+// --- MANAGEMENT ---
+void OrderNegotiate::apply() {
+  negotiations.add(player, tPlayer);
   saveEffect("Negotiation established between " + player->getName() + " and " + tPlayer->getName() + ".");
 }
 
 // --- HELPERS ---
-Order* OrderNegotiate::clone() const { 
-  return new OrderNegotiate(*this); 
+std::unique_ptr<Order> OrderNegotiate::clone() const {
+  return std::make_unique<OrderNegotiate>(*this);
+}
+
+// --- SERIALIZATION ---
+OrderRecord OrderNegotiate::toRecord() const {
+  return {ORDER_TYPES::NEGOTIATE, player, tPlayer, nullptr, nullptr, 0};
 }
 
 
@@ -456,8 +600,8 @@ Order* OrderNegotiate::clone() const {
 OrderCheat::OrderCheat(Player* play) :
   Order(),
   player(play) {
-  type = new std::string(ORDER_TYPES::CHEAT);
-  description = new std::string("Conquers all adjacent territories of the player once per turn.");
+  type = ORDER_TYPES::CHEAT;
+  description = "Conquers all adjacent territories of the player once per turn.";
 }
 
 OrderCheat::OrderCheat(const OrderCheat& other) :
@@ -475,20 +619,21 @@ OrderCheat& OrderCheat::operator=(const OrderCheat& other) {
 OrderCheat::~OrderCheat() = default;
 
 // --- VALIDATION ---
-bool OrderCheat::validate() { 
-  if (player) return true;
-  saveEffect("Invalid cheat order. Not executed.");
-  return false;
+bool OrderCheat::check(const OwnershipView* view) const {
+  return player != nullptr;
+}
+
+bool OrderCheat::staleSince(std::uint64_t version) const {
+  return false; // only depends on who the order names
 }
 
 // --- MANAGEMENT ---
-void OrderCheat::execute() {
-  if (!validate()) {
-    saveEffect("Invalid cheat order. Not executed.");
-    return;
-  }
+void OrderCheat::apply() {
+  // copy the memoized targets since the ownership changes below invalidate them
+  const std::span<Territory* const> cached = player->toAttack();
+  const std::vector targets(cached.begin(), cached.end());
 
-  for (auto& terr : player->toAttack()) {
+  for (auto& terr : targets) {
     Player* originalOwner = terr->getOwner();
     originalOwner->removeTerritory(terr);
     player->addTerritory(terr);
@@ -497,66 +642,123 @@ void OrderCheat::execute() {
 }
 
 // --- HELPERS ---
-Order* OrderCheat::clone() const { 
-  return new OrderCheat(*this); 
+std::unique_ptr<Order> OrderCheat::clone() const {
+  return std::make_unique<OrderCheat>(*this);
+}
+
+// --- SERIALIZATION ---
+OrderRecord OrderCheat::toRecord() const {
+  return {ORDER_TYPES::CHEAT, player, nullptr, nullptr, nullptr, 0};
+}
+
+
+// ==================== OrderBatch Class Implementation ====================
+// --- GETTERS ---
+std::size_t OrderBatch::size() const {
+  return entries.size();
+}
+
+Order* OrderBatch::getOrder(std::size_t index) const {
+  return entries[index].order.get();
+}
+
+Player* OrderBatch::getIssuer(std::size_t index) const {
+  return entries[index].issuer;
+}
+
+// --- MANAGEMENT ---
+void OrderBatch::add(Player* issuer, std::unique_ptr<Order> order) {
+  if (order) entries.push_back(Entry{std::move(order), issuer, false});
+}
+
+void OrderBatch::validateAll(std::span<Player* const> players) {
+  view.capture(players);
+  for (Entry& entry : entries) entry.valid = entry.order->validate(view);
+
+  // the players' map keeps the version; without one, every order is re-checked when it runs
+  const auto withMap = std::ranges::find_if(players, [](const Player* play) { return play->getMap() != nullptr; });
+  validatedAt = withMap != players.end() ? (*withMap)->getMap()->getStateVersion() : 0;
+}
+
+bool OrderBatch::execute(std::size_t index) {
+  Entry& entry = entries[index];
+  Order& order = *entry.order;
+
+  // earlier orders of the phase may have moved armies, changed owners or made truces
+  const bool valid = validatedAt == 0 || order.staleSince(validatedAt) ? order.validate() : entry.valid;
+  if (!valid) {
+    order.reject();
+    return false;
+  }
+
+  order.apply();
+  return true;
+}
+
+void OrderBatch::clear() {
+  entries.clear();
 }
 
 
 // ==================== OrdersList Class Implementation ====================
 OrdersList::OrdersList() :
   Subject(),
-  orders(new std::vector<Order*>()),
   lastAddedOrder(nullptr) {}
 
 OrdersList::OrdersList(const OrdersList& other) :
   Subject(other),
-  orders(new std::vector<Order*>()),
   lastAddedOrder(nullptr) {
   // deep copy orders
-  for (const auto& ord : *other.orders) {
-    orders->push_back(ord->clone());
+  for (const auto& ord : other.orders) {
+    orders.push_back(ord->clone());
   }
-  if (!orders->empty()) lastAddedOrder = orders->back();
+  if (!orders.empty()) lastAddedOrder = orders.back().get();
 }
 
+OrdersList::OrdersList(OrdersList&& other) noexcept = default;
+
 OrdersList& OrdersList::operator=(const OrdersList& other) {
   if (this != &other) {
     Subject::operator=(other);
-    // delete old objects
-    for (const Order* ord : *orders) { delete ord; }
-    orders->clear();
+    orders.clear();
 
     // deep copy orders
-    for (const Order* ord : *other.orders) {
-      orders->push_back(ord->clone());
+    for (const auto& ord : other.orders) {
+      orders.push_back(ord->clone());
     }
-    lastAddedOrder = orders->empty() ? nullptr : orders->back();
+    lastAddedOrder = orders.empty() ? nullptr : orders.back().get();
   }
   return *this;
 }
 
-OrdersList::~OrdersList() {
-  for (const Order* ord : *orders) { delete ord; }
-  delete orders;
+OrdersList& OrdersList::operator=(OrdersList&& other) noexcept = default;
 
-  orders = nullptr;
-  lastAddedOrder = nullptr;
-}
+OrdersList::~OrdersList() = default;
 
 // --- MANAGEMENT ---
-void OrdersList::addOrder(Order* order) {
+void OrdersList::addOrder(std::unique_ptr<Order> order) {
   if (!order) return;
 
-  orders->push_back(order);
-  lastAddedOrder = order;
-
-  for (Observer* obs : *observers) order->attach(obs);
+  lastAddedOrder = order.get();
+  for (Observer* obs : observers) order->attach(obs);
+  orders.push_back(std::move(order));
   notify();
 }
 
+std::unique_ptr<Order> OrdersList::popFront() {
+  if (orders.empty()) return nullptr;
+
+  std::unique_ptr<Order> order = std::move(orders.front());
+  orders.erase(orders.begin());
+  if (lastAddedOrder == order.get()) lastAddedOrder = nullptr;
+  return order;
+}
+
 void OrdersList::removeOrder(int index) {
   if (!validateIndex(index)) return;
-  orders->erase(orders->begin() + index);
+
+  if (lastAddedOrder == orders[index].get()) lastAddedOrder = nullptr;
+  orders.erase(orders.begin() + index);
 }
 
 void OrdersList::moveOrder(int oldIdx, int newIdx) {
@@ -564,9 +766,9 @@ void OrdersList::moveOrder(int oldIdx, int newIdx) {
   if (!validateIndex(oldIdx) || !validateIndex(newIdx)) return;
 
   // remove order from the list and reinsert it at the new index
-  Order* order = orders->at(oldIdx);
-  orders->erase(orders->begin() + oldIdx);
-  orders->insert(orders->begin() + newIdx, order);
+  std::unique_ptr<Order> order = std::move(orders[oldIdx]);
+  orders.erase(orders.begin() + oldIdx);
+  orders.insert(orders.begin() + newIdx, std::move(order));
 }
 
 // --- UTILITY ---
@@ -576,14 +778,14 @@ std::string OrdersList::stringToLog() const {
 }
 
 bool OrdersList::validateIndex(int index) {
-  return index >= 0 && index < orders->size();
+  return index >= 0 && index < orders.size();
 }
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const OrdersList& ordLst) {
-  os << "Orders List[" << ordLst.orders->size() << " orders:\n";
-  for (size_t i = 0; i < ordLst.orders->size(); i++) {
-    os << "  - " << (i + 1) << ". " << *(*ordLst.orders)[i] << "\n";
+  os << "Orders List[" << ordLst.orders.size() << " orders:\n";
+  for (size_t i = 0; i < ordLst.orders.size(); i++) {
+    os << "  - " << (i + 1) << ". " << *ordLst.orders[i] << "\n";
   }
   os << "]";
   return os;
@@ -2,7 +2,11 @@
 #include "LoggingObserver.h"
 #include "Player.h"
 
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
 struct NegotiationRecord {
@@ -10,44 +14,119 @@ struct NegotiationRecord {
   Player* player2;
 };
 
+/*
+Truces made this turn, stamped into a symmetric matrix indexed by player slot.
+Checking a pair is a single lookup and starting a new turn only bumps the epoch.
+*/
+class NegotiationTable {
+private:
+  std::vector<std::uint32_t> stamps;      // capacity x capacity, a pair is at truce while its stamp equals epoch
+  std::vector<NegotiationRecord> records; // this turn's pairs in the order they were made, for snapshots
+  std::uint32_t epoch = 1;
+  int capacity = 0;
+  std::uint64_t changedAt = 0;            // map state version of the last truce made
+
+public:
+  // getters
+  const std::vector<NegotiationRecord>& getRecords() const;
+  std::uint64_t getChangedAt() const;
+
+  // management
+  void add(Player* player1, Player* player2);
+  bool atTruce(const Player* player1, const Player* player2) const;
+  void reset();
+
+private:
+  // helpers
+  void grow(int slots);
+};
+
+/*
+Flat description of an order, used to save pending orders and rebuild them on load.
+*/
+struct OrderRecord {
+  std::string type;
+  Player* player = nullptr;
+  Player* targetPlayer = nullptr; // negotiation target, or the neutral player of a blockade
+  Territory* source = nullptr;
+  Territory* target = nullptr;
+  int soldiers = 0;
+};
+
+
+/*
+Territory ownership captured once for a batch of orders: one bitset per player slot over territory indices.
+*/
+class OwnershipView {
+private:
+  std::vector<std::vector<std::uint64_t>> owned; // [player slot][territory index / 64]
+  std::vector<bool> captured;                    // per player slot
+
+public:
+  // management
+  void capture(std::span<Player* const> players);
+
+  // utility
+  bool owns(Player* player, Territory* terr) const; // falls back to the player's list for anyone not captured
+};
+
 
 /*
 Abstract base class for all order types.
 */
 class Order : public Subject, public ILoggable {
 protected:
-  std::string* type;
-  std::string* description;
-  std::string* effect;
+  std::string_view type;        // set by each subclass from a string literal
+  std::string_view description;
+  std::string effect;
 
-  // needs to be cleared every turn in the game engine
-  static std::unique_ptr<std::vector<NegotiationRecord>> negotiationRecords;
+  // needs to be reset every turn in the game engine; one per thread, so concurrent games keep their own truces
+  static thread_local NegotiationTable negotiations;
 
 public:
   Order();
   Order(const Order& other); // copy constructor
+  Order(Order&& other) noexcept; // move constructor
   Order& operator=(const Order& other); // assignment operator
+  Order& operator=(Order&& other) noexcept; // move assignment operator
   virtual ~Order(); // destructor
 
   // getters
+  std::string getType() const;
   std::string getEffect() const;
 
   // validation
-  virtual bool validate() = 0; // validates an order is valid based on the current game state
+  bool validate(); // validates an order is valid based on the current game state
+  bool validate(const OwnershipView& view); // same, reading ownership from a batch's view
+  virtual bool staleSince(std::uint64_t version) const = 0; // true when state this order checks changed since version
 
   // management
-  virtual void execute() = 0; // executes the order, assuming it has been validated
+  void execute(); // validates, then applies
+  virtual void apply() = 0; // executes the order, assuming it has been validated
 
   // helper
-  virtual Order* clone() const = 0;
+  virtual std::unique_ptr<Order> clone() const = 0;
+
+  // serialization
+  virtual OrderRecord toRecord() const = 0;
+  static std::unique_ptr<Order> fromRecord(const OrderRecord& rec);
 
   // utility
   void saveEffect(const std::string& eff);
   std::string stringToLog() const override;
-  static void clearNegotiationRecords();
+  static const std::vector<NegotiationRecord>& getNegotiationRecords();
+  static void addNegotiationRecord(Player* player1, Player* player2);
+  static bool atTruce(const Player* player1, const Player* player2);
+  static void resetNegotiations();
+  void reject(); // records that the order was not executed
 
   // stream insertion operator
   friend std::ostream& operator<<(std::ostream& os, const Order& ord);
+
+protected:
+  // validation
+  virtual bool check(const OwnershipView* view) const = 0; // ownership is read live when there is no view
+  static bool owns(const OwnershipView* view, Player* player, Territory* terr);
 };
 
 
@@ -55,22 +134,29 @@ class OrderDeploy : public Order {
 private:
   Player* player;
   Territory* target;
-  int* soldiers;
+  int soldiers;
 
 public:
-  OrderDeploy(Player* play, Territory* targ, int* sold);
+  OrderDeploy(Player* play, Territory* targ, int sold);
   OrderDeploy(const OrderDeploy& other); // copy constructor
   OrderDeploy& operator=(const OrderDeploy& other); // assignment operator
   ~OrderDeploy() override; // destructor
 
   // validation
-  bool validate() override;
+  bool staleSince(std::uint64_t version) const override;
 
   // management
-  void execute() override;
+  void apply() override;
 
   // helper
-  Order* clone() const override;
+  std::unique_ptr<Order> clone() const override;
+
+  // serialization
+  OrderRecord toRecord() const override;
+
+protected:
+  // validation
+  bool check(const OwnershipView* view) const override;
 };
 
 
@@ -79,22 +165,29 @@ private:
   Player* player;
   Territory* source;
   Territory* target;
-  int* soldiers;
+  int soldiers;
 
 public:
-  OrderAdvance(Player* play, Territory* src, Territory* targ, int* sold);
+  OrderAdvance(Player* play, Territory* src, Territory* targ, int sold);
   OrderAdvance(const OrderAdvance& other); // copy constructor
   OrderAdvance& operator=(const OrderAdvance& other); // assignment operator
   ~OrderAdvance() override; // destructor
 
   // validation
-  bool validate() override;
+  bool staleSince(std::uint64_t version) const override;
 
   // management
-  void execute() override;
+  void apply() override;
 
   // helper
-  Order* clone() const override;
+  std::unique_ptr<Order> clone() const override;
+
+  // serialization
+  OrderRecord toRecord() const override;
+
+protected:
+  // validation
+  bool check(const OwnershipView* view) const override;
 };
 
 
@@ -103,22 +196,29 @@ private:
   Player* player;
   Territory* source;
   Territory* target;
-  int* soldiers;
+  int soldiers;
 
 public:
-  OrderAirlift(Player* play, Territory* src, Territory* targ, int* sold);
+  OrderAirlift(Player* play, Territory* src, Territory* targ, int sold);
   OrderAirlift(const OrderAirlift& other); // copy constructor
   OrderAirlift& operator=(const OrderAirlift& other); // assignment operator
   ~OrderAirlift() override; // destructor
 
   // validation
-  bool validate() override;
+  bool staleSince(std::uint64_t version) const override;
 
   // management
-  void execute() override;
+  void apply() override;
 
   // helper
-  Order* clone() const override;
+  std::unique_ptr<Order> clone() const override;
+
+  // serialization
+  OrderRecord toRecord() const override;
+
+protected:
+  // validation
+  bool check(const OwnershipView* view) const override;
 };
 
 
@@ -134,13 +234,20 @@ public:
   ~OrderBomb() override; // destructor
 
   // validation
-  bool validate() override;
+  bool staleSince(std::uint64_t version) const override;
 
   // management
-  void execute() override;
+  void apply() override;
 
   // helper
-  Order* clone() const override;
+  std::unique_ptr<Order> clone() const override;
+
+  // serialization
+  OrderRecord toRecord() const override;
+
+protected:
+  // validation
+  bool check(const OwnershipView* view) const override;
 };
 
 
@@ -157,13 +264,20 @@ public:
   ~OrderBlockade() override; // destructor
 
   // validation
-  bool validate() override;
+  bool staleSince(std::uint64_t version) const override;
 
   // management
-  void execute() override;
+  void apply() override;
 
   // helper
-  Order* clone() const override;
+  std::unique_ptr<Order> clone() const override;
+
+  // serialization
+  OrderRecord toRecord() const override;
+
+protected:
+  // validation
+  bool check(const OwnershipView* view) const override;
 };
 
 
@@ -179,13 +293,20 @@ public:
   ~OrderNegotiate() override; // destructor
 
   // validation
-  bool validate() override;
+  bool staleSince(std::uint64_t version) const override;
 
   // management
-  void execute() override;
+  void apply() override;
 
   // helper
-  Order* clone() const override;
+  std::unique_ptr<Order> clone() const override;
+
+  // serialization
+  OrderRecord toRecord() const override;
+
+protected:
+  // validation
+  bool check(const OwnershipView* view) const override;
 };
 
 
@@ -200,27 +321,67 @@ public:
   ~OrderCheat() override; // destructor
 
   // validation
-  bool validate() override;
+  bool staleSince(std::uint64_t version) const override;
 
   // management
-  void execute() override;
+  void apply() override;
 
   // helper
-  Order* clone() const override;
+  std::unique_ptr<Order> clone() const override;
+
+  // serialization
+  OrderRecord toRecord() const override;
+
+protected:
+  // validation
+  bool check(const OwnershipView* view) const override;
+};
+
+
+/*
+One execution phase worth of orders, validated together against a single ownership view.
+An order is re-checked when it runs only if state it depends on changed after the batch was validated.
+*/
+class OrderBatch {
+private:
+  struct Entry {
+    std::unique_ptr<Order> order;
+    Player* issuer;
+    bool valid;
+  };
+
+  std::vector<Entry> entries;
+  OwnershipView view;
+  std::uint64_t validatedAt = 0; // state version of the players' map the verdicts were computed at, 0 = always re-check
+
+public:
+  // getters
+  std::size_t size() const;
+  Order* getOrder(std::size_t index) const;
+  Player* getIssuer(std::size_t index) const;
+
+  // management
+  void add(Player* issuer, std::unique_ptr<Order> order);
+  void validateAll(std::span<Player* const> players);
+  bool execute(std::size_t index); // returns whether the order was applied
+  void clear();
 };
 
 
 class OrdersList : public Subject, public ILoggable {
 public:
-  std::vector<Order*>* orders;
+  std::vector<std::unique_ptr<Order>> orders;
 
   OrdersList();
   OrdersList(const OrdersList& other); // copy constructor
+  OrdersList(OrdersList&& other) noexcept; // move constructor
   OrdersList& operator=(const OrdersList& other); // assignment operator
+  OrdersList& operator=(OrdersList&& other) noexcept; // move assignment operator
   ~OrdersList() override; // destructor
 
   // management
-  void addOrder(Order* order);
+  void addOrder(std::unique_ptr<Order> order);
+  std::unique_ptr<Order> popFront(); // hands the next order to the caller, nullptr when empty
   void removeOrder(int index);
   void moveOrder(int oldIdx, int newIdx); // move an order from one index to another
 
@@ -231,7 +392,7 @@ public:
   friend std::ostream& operator<<(std::ostream& os, const OrdersList& ordLst);
 
 private:
-  Order* lastAddedOrder;
+  Order* lastAddedOrder; // non-owning, for logging
 
   // utility
   bool validateIndex(int index);
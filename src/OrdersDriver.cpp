@@ -3,10 +3,12 @@
 #include "Orders.h"
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 void testOrdersLists() {
   // testing order functions
-  Order* testOrder = new OrderDeploy(nullptr, nullptr, nullptr);
+  Order* testOrder = new OrderDeploy(nullptr, nullptr, 0);
 
   // testing validate() and execute()
   std::cout << "Testing validate() and execute() on a Deploy Order:" << '\n';
@@ -16,12 +18,12 @@ void testOrdersLists() {
 
   // testing OrdersList functions
   OrdersList ordersList;
-  ordersList.addOrder(new OrderDeploy(nullptr, nullptr, nullptr));
-  ordersList.addOrder(new OrderAdvance(nullptr, nullptr, nullptr, nullptr));
-  ordersList.addOrder(new OrderBomb(nullptr, nullptr));
-  ordersList.addOrder(new OrderBlockade(nullptr, nullptr, nullptr));
-  ordersList.addOrder(new OrderAirlift(nullptr, nullptr, nullptr, nullptr));
-  ordersList.addOrder(new OrderNegotiate(nullptr, nullptr));
+  ordersList.addOrder(std::make_unique<OrderDeploy>(nullptr, nullptr, 0));
+  ordersList.addOrder(std::make_unique<OrderAdvance>(nullptr, nullptr, nullptr, 0));
+  ordersList.addOrder(std::make_unique<OrderBomb>(nullptr, nullptr));
+  ordersList.addOrder(std::make_unique<OrderBlockade>(nullptr, nullptr, nullptr));
+  ordersList.addOrder(std::make_unique<OrderAirlift>(nullptr, nullptr, nullptr, 0));
+  ordersList.addOrder(std::make_unique<OrderNegotiate>(nullptr, nullptr));
 
   // testing addOrder()
   std::cout << ordersList << std::endl;
@@ -42,10 +44,10 @@ void testOrdersLists() {
 }
 
 void testOrderExecution() {
-  Deck* deck = new Deck();
-  Player* player1 = new Player("Player1", deck);
-  Player* player2 = new Player("Player2", deck);
-  Player* nPlayer = new Player("Neutral player", deck);
+  Deck deck;
+  Player* player1 = new Player("Player1", &deck);
+  Player* player2 = new Player("Player2", &deck);
+  Player* nPlayer = new Player("Neutral player", &deck);
 
   Territory* territoryA = new Territory("TerritoryA", 1);
   territoryA->setArmies(20);
@@ -79,7 +81,7 @@ void testOrderExecution() {
             << territoryB->getOwner()->getName() << '\n';
   std::cout << "Before attack Player1->conqueredThisTurn = "<< player1->getConqueredThisTurn() << '\n';
 
-  Order* advanceOrder = new OrderAdvance(player1, territoryA, territoryB, new int(19));
+  auto advanceOrder = std::make_unique<OrderAdvance>(player1, territoryA, territoryB, 19);
   advanceOrder->execute();
   std::cout << "After Advance Order Execution: " << territoryB->getArmies() << " armies in TerritoryA, belongs to "
             << territoryB->getOwner()->getName() << '\n';
@@ -87,12 +89,12 @@ void testOrderExecution() {
   std::cout << "\n";
 
   // (4) the negotiate order prevents attacks between the two players involved; 
-  Order* negotiateOrder = new OrderNegotiate(player2, player1);
+  auto negotiateOrder = std::make_unique<OrderNegotiate>(player2, player1);
   negotiateOrder->execute();
   std::cout << "Before Advance Order Execution with Negotiation: " << territoryD->getArmies()
             << " armies in TerritoryD, belongs to " << territoryD->getOwner()->getName() << '\n';
 
-  Order* advanceOrderWithNegotiation = new OrderAdvance(player1, territoryC, territoryD, new int(5));
+  auto advanceOrderWithNegotiation = std::make_unique<OrderAdvance>(player1, territoryC, territoryD, 5);
   advanceOrderWithNegotiation->execute();
   std::cout << "After Advance Order Execution with Negotiation: " << territoryD->getArmies()
             << " armies in TerritoryD, belongs to " << territoryD->getOwner()->getName() << '\n';
@@ -101,7 +103,7 @@ void testOrderExecution() {
   // (5) the blockade order transfers ownership to the Neutral player; 
   std::cout << "Before Blockade Order Execution: " << territoryC->getArmies() << " armies in TerritoryC, belongs to "
             << territoryC->getOwner()->getName() << '\n';
-  Order* blockadeOrder = new OrderBlockade(nPlayer, player1, territoryC);
+  auto blockadeOrder = std::make_unique<OrderBlockade>(nPlayer, player1, territoryC);
   blockadeOrder->execute();
   std::cout << "After Blockade Order Execution: " << territoryC->getArmies() << " armies in TerritoryC, belongs to "
             << territoryC->getOwner()->getName() << '\n';
@@ -114,6 +116,49 @@ void testOrderExecution() {
   std::cout << "Player1's Orders List:" << '\n';
   std::cout << *(player1->getOrders()) << '\n';
 
+  // (7) a phase's orders are validated together up front, and an order is checked again when an earlier one
+  // of the same phase changed something it depends on
+  Order::resetNegotiations();
+  Map batchMap("Batch");
+  Territory* home = batchMap.addTerritory("Home", 1);
+  Territory* front = batchMap.addTerritory("Front", 2);
+  Territory* rear = batchMap.addTerritory("Rear", 3);
+  Map::addAdjacency(home, front);
+  Map::addAdjacency(home, rear);
+
+  Player attacker("Attacker", &deck);
+  Player defender("Defender", &deck);
+  attacker.addTerritory(home);
+  attacker.addTerritory(rear);
+  defender.addTerritory(front);
+  home->setArmies(20);
+  front->setArmies(1);
+  rear->setArmies(1);
+  const std::vector<Player*> roster = {&attacker, &defender};
+
+  // a truce made by the first order turns the attack behind it invalid
+  OrderBatch truceFirst;
+  truceFirst.add(&defender, std::make_unique<OrderNegotiate>(&attacker, &defender));
+  truceFirst.add(&attacker, std::make_unique<OrderAdvance>(&attacker, home, front, 10));
+  truceFirst.validateAll(roster);
+  truceFirst.execute(0);
+  const bool attacked = truceFirst.execute(1);
+  std::cout << "\nAdvance validated before a truce made earlier in the phase: " << (attacked ? "applied" : "rejected")
+            << ", Front belongs to " << front->getOwner()->getName() << ", Home has " << home->getArmies() << " armies\n";
+  Order::resetNegotiations();
+
+  // the first advance drains the source the second one was validated against
+  OrderBatch drainedFirst;
+  drainedFirst.add(&attacker, std::make_unique<OrderAdvance>(&attacker, home, rear, 15));
+  drainedFirst.add(&attacker, std::make_unique<OrderAdvance>(&attacker, home, front, 15));
+  drainedFirst.validateAll(roster);
+  const bool moved = drainedFirst.execute(0);
+  const bool attackedAfter = drainedFirst.execute(1);
+  std::cout << "Second advance from a source the first one drained: first " << (moved ? "applied" : "rejected")
+            << ", second " << (attackedAfter ? "applied" : "rejected") << ", Home has " << home->getArmies()
+            << " armies, Front belongs to " << front->getOwner()->getName() << "\n";
+  std::cout << "Stale verdicts re-checked: " << (!attacked && moved && !attackedAfter ? "YES" : "NO") << '\n';
+
   // cleanup
   delete player1;
   delete player2;
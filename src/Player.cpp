@@ -1,121 +1,183 @@
 #include "Player.h"
 #include "Cards.h"
+#include "Input.h"
 #include "Map.h"
 #include "Orders.h"
 #include "PlayerStrategies.h"
+#include "Profiler.h"
 
 #include <algorithm>
+#include <mutex>
 #include <numeric>
+#include <utility>
+
+namespace {
+  // slots of destroyed players are handed out again, so slot-indexed tables stay as small as the roster;
+  // shared by games running on different threads, and never freed, since static players (the neutral one)
+  // release their slot during static destruction
+  struct SlotPool {
+    std::mutex mutex;
+    std::vector<int> free;
+    int next = 0;
+  };
+
+  SlotPool& slotPool() {
+    static auto* pool = new SlotPool();
+    return *pool;
+  }
 
+  int acquireSlot() {
+    SlotPool& pool = slotPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if (pool.free.empty()) return pool.next++;
+    const int slot = pool.free.back();
+    pool.free.pop_back();
+    return slot;
+  }
+
+  void releaseSlot(int slot) {
+    if (slot < 0) return; // moved-from players hold no slot
+    SlotPool& pool = slotPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.free.push_back(slot);
+  }
+}
 
 // ==================== Player Class Implementation ====================
 Player::Player() :
-  name(new std::string("Default")),
-  territories(new std::vector<Territory*>()),
-  hand(new Hand()),
-  ordersList(new OrdersList()),
-  reinforcementPool(new int(0)),
-  conqueredThisTurn(new bool(false)),
+  name("Default"),
+  slot(acquireSlot()),
+  hand(std::make_unique<Hand>()),
+  ordersList(std::make_unique<OrdersList>()),
+  reinforcementPool(0),
+  conqueredThisTurn(false),
   deck(nullptr),
-  pendingReinforcements(new int(0)),
-  canIssueOrder(new bool(true)),
-  gotAttackedThisTurn(new bool(false)),
-  strategy(nullptr) {}
+  pendingReinforcements(0),
+  canIssueOrder(true),
+  gotAttackedThisTurn(false) {}
 
 Player::Player(const std::string& newName, Deck* newDeck) :
-  name(new std::string(newName)),
-  territories(new std::vector<Territory*>()),
-  hand(new Hand()),
-  ordersList(new OrdersList()),
-  reinforcementPool(new int(0)),
-  conqueredThisTurn(new bool(false)),
+  name(newName),
+  slot(acquireSlot()),
+  hand(std::make_unique<Hand>()),
+  ordersList(std::make_unique<OrdersList>()),
+  reinforcementPool(0),
+  conqueredThisTurn(false),
   deck(newDeck),
-  pendingReinforcements(new int(0)),
-  canIssueOrder(new bool(true)),
-  gotAttackedThisTurn(new bool(false)),
-  strategy(nullptr) {}
+  pendingReinforcements(0),
+  canIssueOrder(true),
+  gotAttackedThisTurn(false) {}
 
 Player::Player(const Player& other) :
-  name(new std::string(*other.name)),
-  territories(new std::vector(*other.territories)),
-  hand(new Hand(*other.hand)),
-  ordersList(new OrdersList(*other.ordersList)),
-  reinforcementPool(new int(*other.reinforcementPool)),
-  conqueredThisTurn(new bool(*other.conqueredThisTurn)),
+  name(other.name),
+  slot(acquireSlot()),
+  territories(other.territories),
+  hand(std::make_unique<Hand>(*other.hand)),
+  ordersList(std::make_unique<OrdersList>(*other.ordersList)),
+  reinforcementPool(other.reinforcementPool),
+  conqueredThisTurn(other.conqueredThisTurn),
   deck(other.deck),
-  pendingReinforcements(new int(*other.pendingReinforcements)),
-  canIssueOrder(new bool(*other.canIssueOrder)),
-  gotAttackedThisTurn(new bool(*other.gotAttackedThisTurn)),
-  strategy(nullptr) {}
+  pendingReinforcements(other.pendingReinforcements),
+  canIssueOrder(other.canIssueOrder),
+  gotAttackedThisTurn(other.gotAttackedThisTurn) {}
 
 Player& Player::operator=(const Player& other) {
   if (this != &other) {
-    delete name;
-    delete territories;
-    delete hand;
-    delete ordersList;
-    delete reinforcementPool;
-    delete conqueredThisTurn;
-    delete pendingReinforcements;
-    delete canIssueOrder;
-    delete gotAttackedThisTurn;
-    delete strategy;
-
-    // deep copy primitives and container
-    name = new std::string(*other.name);
-    territories = new std::vector(*other.territories);
-    hand = new Hand(*other.hand);
-    ordersList = new OrdersList(*other.ordersList);
-    reinforcementPool = new int(*other.reinforcementPool);
-    conqueredThisTurn = new bool(*other.conqueredThisTurn);
-    pendingReinforcements = new int(*other.pendingReinforcements);
-    canIssueOrder = new bool(*other.canIssueOrder);
-    gotAttackedThisTurn = new bool(*other.gotAttackedThisTurn);
+    // deep copy owned objects, values copy as is
+    name = other.name;
+    territories = other.territories;
+    if (hand) *hand = *other.hand;
+    else hand = std::make_unique<Hand>(*other.hand);
+    if (ordersList) *ordersList = *other.ordersList;
+    else ordersList = std::make_unique<OrdersList>(*other.ordersList);
+    reinforcementPool = other.reinforcementPool;
+    conqueredThisTurn = other.conqueredThisTurn;
+    pendingReinforcements = other.pendingReinforcements;
+    canIssueOrder = other.canIssueOrder;
+    gotAttackedThisTurn = other.gotAttackedThisTurn;
+    defendCache = TerritoryCache();
+    attackCache = TerritoryCache();
 
     // shallow copy shared references
     deck = other.deck;
     // do not copy strategy
-    strategy = nullptr;
+    strategy.reset();
+  }
+  return *this;
+}
+
+Player::Player(Player&& other) noexcept :
+  name(std::move(other.name)),
+  slot(std::exchange(other.slot, -1)),
+  territories(std::move(other.territories)),
+  hand(std::move(other.hand)),
+  ordersList(std::move(other.ordersList)),
+  reinforcementPool(other.reinforcementPool),
+  conqueredThisTurn(other.conqueredThisTurn),
+  deck(other.deck),
+  pendingReinforcements(other.pendingReinforcements),
+  canIssueOrder(other.canIssueOrder),
+  gotAttackedThisTurn(other.gotAttackedThisTurn) {} // the strategy stays behind, it points at the other player
+
+Player& Player::operator=(Player&& other) noexcept {
+  if (this != &other) {
+    // the slot moves over and ours goes back to the pool
+    releaseSlot(slot);
+    slot = std::exchange(other.slot, -1);
+
+    name = std::move(other.name);
+    territories = std::move(other.territories);
+    hand = std::move(other.hand);
+    ordersList = std::move(other.ordersList);
+    reinforcementPool = other.reinforcementPool;
+    conqueredThisTurn = other.conqueredThisTurn;
+    pendingReinforcements = other.pendingReinforcements;
+    canIssueOrder = other.canIssueOrder;
+    gotAttackedThisTurn = other.gotAttackedThisTurn;
+    defendCache = TerritoryCache();
+    attackCache = TerritoryCache();
+    deck = other.deck;
+    // do not move strategy
+    strategy.reset();
   }
   return *this;
 }
 
 Player::~Player() {
-  delete name;
-  delete territories;
-  delete hand;
-  delete ordersList;
-  delete reinforcementPool;
-  delete conqueredThisTurn;
-  delete pendingReinforcements;
-  delete canIssueOrder;
-  delete gotAttackedThisTurn;
-  delete strategy;
+  releaseSlot(slot);
 }
 
 // --- GETTERS ---
-std::string Player::getName() const {
-  return *name;
+const std::string& Player::getName() const {
+  return name;
+}
+
+int Player::getSlot() const {
+  return slot;
 }
 
 const std::vector<Territory*>& Player::getTerritories() const {
-  return *territories;
+  return territories;
+}
+
+Map* Player::getMap() const {
+  return territories.empty() ? nullptr : territories.front()->getMap();
 }
 
 Hand* Player::getHand() const {
-  return hand;
+  return hand.get();
 }
 
 OrdersList* Player::getOrders() const {
-  return ordersList;
+  return ordersList.get();
 }
 
 int Player::getReinforcementPool() const {
-  return *reinforcementPool;
+  return reinforcementPool;
 }
 
 bool Player::getConqueredThisTurn() const {
-  return *conqueredThisTurn;
+  return conqueredThisTurn;
 }
 
 Deck* Player::getDeck() const {
@@ -123,87 +185,98 @@ Deck* Player::getDeck() const {
 }
 
 int Player::getPendingReinforcements() const {
-  return *pendingReinforcements;
+  return pendingReinforcements;
 }
 
-bool* Player::getCanIssueOrder() const {
+bool Player::getCanIssueOrder() const {
   return canIssueOrder;
 }
 
-bool* Player::getGotAttackedThisTurn() const {
+bool Player::getGotAttackedThisTurn() const {
   return gotAttackedThisTurn;
 }
 
 PlayerStrategy* Player::getPlayerStrategy() const {
-  return strategy;
+  return strategy.get();
 }
 
 // --- SETTERS ---
 void Player::setName(const std::string& newName) {
-  *name = newName;
+  name = newName;
 }
 
 void Player::setReinforcementPool(int armies) {
-  *reinforcementPool = armies;
+  reinforcementPool = armies;
 }
 
 void Player::setConqueredThisTurn(bool conquered) {
-  *conqueredThisTurn = conquered;
+  conqueredThisTurn = conquered;
 }
 
 void Player::setPendingReinforcements(int armies) {
-  *pendingReinforcements = armies;
+  pendingReinforcements = armies;
 }
 
 void Player::setCanIssueOrder(bool value) {
-  *canIssueOrder = value;
+  canIssueOrder = value;
 }
 
 void Player::setGotAttackedThisTurn(bool attacked) {
-  *gotAttackedThisTurn = attacked;
+  gotAttackedThisTurn = attacked;
 }
 
-void Player::setStrategy(PlayerStrategy* newStrategy) {
-  strategy = newStrategy;
+void Player::setStrategy(std::unique_ptr<PlayerStrategy> newStrategy) {
+  strategy = std::move(newStrategy);
+
+  // results of the previous strategy no longer apply
+  defendCache.version = 0;
+  attackCache.version = 0;
 }
 
 // --- TERRITORY MANAGEMENT ---
 void Player::addTerritory(Territory* terr) {
   if (terr && !ownsTerritory(terr)) {
-    territories->push_back(terr);
-    terr->setOwner(this);
+    territories.push_back(terr);
+    terr->setOwner(this); // stamps the change on the territory's map
   }
 }
 
 void Player::removeTerritory(Territory* terr) {
   if (terr) terr->setOwner(nullptr);
-  std::erase(*territories, terr);
+  std::erase(territories, terr);
 }
 
 bool Player::ownsTerritory(Territory* terr) const {
   if (!terr) return false;
-  return std::ranges::any_of(*territories, [terr](const Territory* t) {
+  return std::ranges::any_of(territories, [terr](const Territory* t) {
     return t->getName() == terr->getName() && t->getId() == terr->getId();
   });
 }
 
 // --- CARD MANAGEMENT ---
-void Player::addCard(Card* card) {
-  if (card) hand->addCard(card);
+void Player::addCard(CardType card) {
+  hand->addCard(card);
 }
 
 void Player::playCard(int index, Deck* gameDeck) {
-  if (hand && gameDeck) hand->playCard(index, this, ordersList, gameDeck);
+  hand->playCard(index, this, ordersList.get(), gameDeck ? gameDeck : deck);
+}
+
+void Player::playCard(CardType card, Deck* gameDeck) {
+  hand->playCard(card, this, ordersList.get(), gameDeck ? gameDeck : deck);
 }
 
 // --- ORDER MANAGEMENT ---
 void Player::issueOrder() {
-  if (strategy) this->strategy->issueOrder();
+  if (!strategy) return;
+
+  PROFILE_SCOPE(ProfileCategory::STRATEGY, *strategy->getStrategy());
+  this->strategy->issueOrder();
 }
 
 void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
   if (deployPhase) {
-    const std::vector<Territory*> defendList = toDefend();
+    const std::span<Territory* const> defendList = toDefend();
     const int reinforcePool = getReinforcementPool();
 
     if (reinforcePool > 0 && !defendList.empty()) {
@@ -217,28 +290,25 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
       int choice = -1;
       while (choice < 0 || choice >= defendList.size()) {
         std::cout << "Choose territory to deploy to (index): ";
-        std::cin >> choice;
+        choice = Input::readInt();
       }
 
       int armies = -1;
       while (armies <= 0 || armies > reinforcePool) {
         std::cout << "Enter number of armies to deploy (max " << reinforcePool << "): ";
-        std::cin >> armies;
+        armies = Input::readInt();
       }
 
       this->issueDeployOrder(defendList[choice], armies);
-      *reinforcementPool -= armies;
+      reinforcementPool -= armies;
       std::cout << armies << " armies deployed to " << defendList[choice]->getName() << ".\n";
     }
   } else {
     // advance phase
     if (advanceIssued) return; // only one advance order per player
 
-    std::vector<Territory*> attackList = toAttack();
-    std::vector<Territory*> defendList = toDefend();
-
     bool canAdvance = false;
-    for (const Territory* t : *territories) {
+    for (const Territory* t : territories) {
       if (t->getArmies() > 1) {
         canAdvance = true;
         break;
@@ -253,7 +323,7 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
         int cardIndex = -2;
         while (cardIndex < -1 || cardIndex >= hand->size()) {
           std::cout << "Choose a card to play: (-1 for no cards) ";
-          std::cin >> cardIndex;
+          cardIndex = Input::readInt(-2);
         }
 
         if (cardIndex == -1) return;
@@ -264,13 +334,13 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
 
     std::cout << "\nPlayer " << getName() << " - Advance Phase\n";
     std::cout << "Your territories:\n";
-    for (size_t i = 0; i < territories->size(); i++) {
-      std::cout << i << ": " << territories->at(i)->getName()
-                << " (Armies: " << territories->at(i)->getArmies() << ")\n";
+    for (size_t i = 0; i < territories.size(); i++) {
+      std::cout << i << ": " << territories.at(i)->getName()
+                << " (Armies: " << territories.at(i)->getArmies() << ")\n";
     }
 
     std::vector<Territory*> territoriesWithEnemies;
-    for (Territory* t : *territories) {
+    for (Territory* t : territories) {
       if (!t) continue;
 
       const std::vector<Territory*>& adj = t->getAdjTerritories();
@@ -297,17 +367,17 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
     while (true) { // loop until a valid source + target is chosen
       // pick source territory
       int sourceIndex = -1;
-      while (sourceIndex < 0 || sourceIndex >= territories->size() || territories->at(sourceIndex)->getArmies() <= 1) {
+      while (sourceIndex < 0 || sourceIndex >= territories.size() || territories.at(sourceIndex)->getArmies() <= 1) {
         std::cout << "Choose source territory (index, must have >1 army): ";
-        std::cin >> sourceIndex;
+        sourceIndex = Input::readInt();
       }
-      source = territories->at(sourceIndex);
+      source = territories.at(sourceIndex);
 
       // choose target type
       int targetType = -1;
       while (targetType != 0 && targetType != 1) {
         std::cout << "Target type: 0 = defend (own), 1 = attack (enemy): ";
-        std::cin >> targetType;
+        targetType = Input::readInt();
       }
 
       // filter adjacent territories based on target type
@@ -340,7 +410,7 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
       int targetIndex = -1;
       while (targetIndex < 0 || targetIndex >= validTargets.size()) {
         std::cout << "Choose target territory (index): -1 to reselect source: ";
-        std::cin >> targetIndex;
+        targetIndex = Input::readInt();
 
         if (targetIndex == -1) break; // reselect source
       }
@@ -351,7 +421,7 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
       int armies = -1;
       while (armies <= 0 || armies > source->getArmies() - 1) {
         std::cout << "Enter number of armies to move (max " << source->getArmies() - 1 << "): ";
-        std::cin >> armies;
+        armies = Input::readInt();
       }
 
       // issue order and exit loop
@@ -371,7 +441,7 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
       int cardIndex = -2;
       while (cardIndex < -1 || cardIndex >= hand->size()) {
         std::cout << "Choose a card to play: (-1 for no cards) ";
-        std::cin >> cardIndex;
+        cardIndex = Input::readInt(-2);
       }
 
       if(cardIndex == -1) return;
@@ -381,42 +451,57 @@ void Player::issueOrder(bool deployPhase, bool& advanceIssued, Deck* gameDeck) {
 }
 
 void Player::issueDeployOrder(Territory* target, int armies) {
-  ordersList->addOrder(new OrderDeploy(this, target, new int(armies)));
+  ordersList->addOrder(std::make_unique<OrderDeploy>(this, target, armies));
 }
 
 void Player::issueAdvanceOrder(Territory* source, Territory* target, int armies) {
-  ordersList->addOrder(new OrderAdvance(this, source, target, new int(armies)));
+  ordersList->addOrder(std::make_unique<OrderAdvance>(this, source, target, armies));
 }
 
 void Player::issueAirliftOrder(Territory* source, Territory* target, int armies) {
-  ordersList->addOrder(new OrderAirlift(this, source, target, new int(armies)));
+  ordersList->addOrder(std::make_unique<OrderAirlift>(this, source, target, armies));
 }
 
 void Player::issueBombOrder(Territory* target) {
-  ordersList->addOrder(new OrderBomb(this, target));
+  ordersList->addOrder(std::make_unique<OrderBomb>(this, target));
 }
 
 void Player::issueBlockadeOrder(Player* player, Territory* target) {
-  ordersList->addOrder(new OrderBlockade(player, this, target));
+  ordersList->addOrder(std::make_unique<OrderBlockade>(player, this, target));
 }
 
 void Player::issueNegotiateOrder(Player* player) {
-  ordersList->addOrder(new OrderNegotiate(player, this));
+  ordersList->addOrder(std::make_unique<OrderNegotiate>(player, this));
 }
 
 void Player::issueCheatOrder() {
-  ordersList->addOrder(new OrderCheat(this));
+  ordersList->addOrder(std::make_unique<OrderCheat>(this));
 }
 
 // --- STRATEGY MANAGEMENT ---
-std::vector<Territory*> Player::toDefend() const {
-  if (strategy) return this->strategy->toDefend();
-  return std::vector<Territory*>();
+std::span<Territory* const> Player::toDefend() const {
+  if (!strategy) return {};
+
+  // recompute only when ownership or armies changed since the last call; without a map there is no version
+  const Map* map = getMap();
+  const std::uint64_t version = map ? map->getStateVersion() : 0;
+  if (version == 0 || defendCache.version != version) {
+    defendCache.territories = this->strategy->toDefend();
+    defendCache.version = version;
+  }
+  return defendCache.territories;
 }
 
-std::vector<Territory*> Player::toAttack() const {
-  if (strategy) return this->strategy->toAttack();
-  return std::vector<Territory*>();
+std::span<Territory* const> Player::toAttack() const {
+  if (!strategy) return {};
+
+  const Map* map = getMap();
+  const std::uint64_t version = map ? map->getStateVersion() : 0;
+  if (version == 0 || attackCache.version != version) {
+    attackCache.territories = this->strategy->toAttack();
+    attackCache.version = version;
+  }
+  return attackCache.territories;
 }
 
 // --- PLAYER MANAGEMENT ---
@@ -431,7 +516,7 @@ Player* Player::choosePlayer(const std::vector<Player*>& players) {
   int choice = -1;
   while (choice < 0 || choice >= players.size()) {
     std::cout << "Enter the number of your choice: ";
-    std::cin >> choice;
+    choice = Input::readInt();
   }
 
   return players[choice];
@@ -439,30 +524,31 @@ Player* Player::choosePlayer(const std::vector<Player*>& players) {
 
 // --- UTILITY ---
 int Player::getTotalArmies() const {
-  return std::accumulate(territories->begin(), territories->end(), 0,
+  // only the player's own territories: a map tally would scan every territory of the map
+  return std::accumulate(territories.begin(), territories.end(), 0,
     [](int currSum, const Territory* t) {
       return currSum + t->getArmies();
     });
 }
 
 int Player::getTerritoryCount() const {
-  return territories->size();
+  return territories.size();
 }
 
 void Player::displayInfo() const {
-  std::cout << "Player: " << (name ? *name : "Unnamed") << std::endl;
-  std::cout << "  Territories: " << (territories ? territories->size() : 0)  << std::endl;
+  std::cout << "Player: " << name << std::endl;
+  std::cout << "  Territories: " << territories.size()  << std::endl;
   std::cout << "  Total Armies: " << getTotalArmies() << std::endl;
-  std::cout << "  Reinforcement Pool: " << (reinforcementPool ? *reinforcementPool : 0) << std::endl;
-  std::cout << "  Cards in Hand: " << (hand ? hand->size() : 0) << std::endl;
-  std::cout << "  Orders: " << (ordersList->orders ? ordersList->orders->size() : 0) << std::endl;
+  std::cout << "  Reinforcement Pool: " << reinforcementPool << std::endl;
+  std::cout << "  Cards in Hand: " << hand->size() << std::endl;
+  std::cout << "  Orders: " << ordersList->orders.size() << std::endl;
 
-  const int numOfTerritories = territories ? territories->size() : 0;
+  const int numOfTerritories = territories.size();
   std::cout << "  Owned Territories (" << numOfTerritories << "): ";
   if (numOfTerritories == 0) {
     std::cout << "None";
   } else {
-    for (const Territory* terr : *territories) {
+    for (const Territory* terr : territories) {
       if (terr) std::cout << "    - " << terr->getName() << " (Armies: " << terr->getArmies() << ")" << std::endl;
     }
   }
@@ -475,9 +561,9 @@ bool Player::operator==(const Player& other) const {
 
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const Player& play) {
-  os << "Player[" << (play.name ? *play.name : "Unnamed")
-     << ", Territories: " << (play.territories ? play.territories->size() : 0)
+  os << "Player[" << play.name
+     << ", Territories: " << play.territories.size()
      << ", Armies: " << play.getTotalArmies()
-     << ", Reinforcement Pool: " << (play.reinforcementPool ? *play.reinforcementPool : 0) << "]";
+     << ", Reinforcement Pool: " << play.reinforcementPool << "]";
   return os;
 }
@@ -1,15 +1,27 @@
 #pragma once
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
+class Map;
 class Territory;
 class Hand;
 class OrdersList;
-class Card;
+enum class CardType : std::uint8_t;
 class Deck;
 class PlayerStrategy;
 
+/**
+ * Memoized toDefend()/toAttack() result, valid while the state version of the player's map is unchanged.
+ */
+struct TerritoryCache {
+  std::vector<Territory*> territories;
+  std::uint64_t version = 0; // map state version the result was computed at (0 = stale)
+};
+
 /**
  * The Player class represents a Warzone player.
  * A player owns a collection of territories, a hand of cards, and a list of orders.
@@ -17,36 +29,43 @@ class PlayerStrategy;
  */
 class Player {
 private:
-  std::string* name;
-  std::vector<Territory*>* territories; // collection of owned territories
-  Hand* hand;                           // player's hand of cards
-  OrdersList* ordersList;               // list of orders to execute
-  int* reinforcementPool;               // number of armies available for deployment
-  bool* conqueredThisTurn;              // flag indicating if the player conquered a territory this turn
-  Deck* deck;                           // pointer to the deck (for drawing/returning cards)
-  int* pendingReinforcements;           // number of armies pending deployment
-  bool* canIssueOrder;                  // flag indicating if the player can issue orders
-  bool* gotAttackedThisTurn;            // flag indicating if the player got attacked this turn
-  PlayerStrategy* strategy;             // strategy pattern for player behavior
+  std::string name;
+  int slot;                                 // small index for per-turn lookup tables, reused once the player is gone (-1 once moved from)
+  std::vector<Territory*> territories;      // collection of owned territories
+  std::unique_ptr<Hand> hand;               // player's hand of cards
+  std::unique_ptr<OrdersList> ordersList;   // list of orders to execute
+  int reinforcementPool;                    // number of armies available for deployment
+  bool conqueredThisTurn;                   // flag indicating if the player conquered a territory this turn
+  Deck* deck;                               // pointer to the deck (for drawing/returning cards)
+  int pendingReinforcements;                // number of armies pending deployment
+  bool canIssueOrder;                       // flag indicating if the player can issue orders
+  bool gotAttackedThisTurn;                 // flag indicating if the player got attacked this turn
+  std::unique_ptr<PlayerStrategy> strategy; // strategy pattern for player behavior
+  mutable TerritoryCache defendCache;       // memoized strategy toDefend() result
+  mutable TerritoryCache attackCache;       // memoized strategy toAttack() result
 
 public:
   Player();
   Player(const std::string& newName, Deck* newDeck);
   Player(const Player& other); // copy constructor
   Player& operator=(const Player& other); // assignment operator
+  Player(Player&& other) noexcept; // move constructor, takes the slot; the moved-from player can only be assigned or destroyed
+  Player& operator=(Player&& other) noexcept; // move assignment operator, takes the slot
   ~Player(); // destructor
 
   // getters
-  std::string getName() const;
+  const std::string& getName() const;
+  int getSlot() const;
   const std::vector<Territory*>& getTerritories() const;
+  Map* getMap() const; // map of the player's territories, nullptr while it holds none
   Hand* getHand() const;
   OrdersList* getOrders() const;
   int getReinforcementPool() const;
   bool getConqueredThisTurn() const;
   Deck* getDeck() const;
   int getPendingReinforcements() const;
-  bool* getCanIssueOrder() const;
-  bool* getGotAttackedThisTurn() const;
+  bool getCanIssueOrder() const;
+  bool getGotAttackedThisTurn() const;
   PlayerStrategy* getPlayerStrategy() const;
 
   // setters
@@ -56,7 +75,7 @@ public:
   void setPendingReinforcements(int armies);
   void setCanIssueOrder(bool canIssue);
   void setGotAttackedThisTurn(bool attacked);
-  void setStrategy(PlayerStrategy* newStrategy);
+  void setStrategy(std::unique_ptr<PlayerStrategy> newStrategy);
 
   // territory management
   void addTerritory(Territory* terr);
@@ -64,8 +83,9 @@ public:
   bool ownsTerritory(Territory* terr) const;
 
   // card management
-  void addCard(Card* card);
+  void addCard(CardType card);
   void playCard(int index, Deck* gameDeck);
+  void playCard(CardType card, Deck* gameDeck);
 
   // order management
   void issueOrder();
@@ -78,9 +98,9 @@ public:
   void issueNegotiateOrder(Player* player);
   void issueCheatOrder();
 
-  // strategy management
-  std::vector<Territory*> toDefend() const;
-  std::vector<Territory*> toAttack() const;
+  // strategy management (spans stay valid until the next call after a map mutation)
+  std::span<Territory* const> toDefend() const;
+  std::span<Territory* const> toAttack() const;
 
   // player management
   static Player* choosePlayer(const std::vector<Player*>& players);
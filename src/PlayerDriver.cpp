@@ -2,6 +2,7 @@
 #include "Map.h"
 #include "Orders.h"
 #include "Player.h"
+#include "Utility.h"
 
 #include <iostream>
 #include <vector>
@@ -62,13 +63,9 @@ void testPlayers() {
 
   // draw some cards for each player
   for (int i = 0; i < 3; i++) {
-    Card* card1 = deck->draw();
-    Card* card2 = deck->draw();
-    Card* card3 = deck->draw();
-
-    if (card1) player1->addCard(card1);
-    if (card2) player2->addCard(card2);
-    if (card3) player3->addCard(card3);
+    if (const auto card = deck->draw(GameRandom::get())) player1->addCard(*card);
+    if (const auto card = deck->draw(GameRandom::get())) player2->addCard(*card);
+    if (const auto card = deck->draw(GameRandom::get())) player3->addCard(*card);
   }
 
   std::cout << "Players' hands after drawing cards:" << std::endl;
@@ -112,16 +109,16 @@ void testPlayers() {
   player2->issueNegotiateOrder(player1);
 
   std::cout << "Orders issued. Order counts:" << std::endl;
-  std::cout << "Player 1 orders: " << player1->getOrders()->orders->size() << std::endl;
-  std::cout << "Player 2 orders: " << player2->getOrders()->orders->size() << std::endl;
-  std::cout << "Player 3 orders: " << player3->getOrders()->orders->size() << std::endl;
+  std::cout << "Player 1 orders: " << player1->getOrders()->orders.size() << std::endl;
+  std::cout << "Player 2 orders: " << player2->getOrders()->orders.size() << std::endl;
+  std::cout << "Player 3 orders: " << player3->getOrders()->orders.size() << std::endl;
 
   // ==================== Test 5: Strategy Management ====================
   std::cout << "\n--- Test 5: Strategy Management (toDefend/toAttack) ---" << std::endl;
 
   // test toDefend method
-  const std::vector<Territory*> defendList1 = player1->toDefend();
-  const std::vector<Territory*> defendList2 = player2->toDefend();
+  const std::span<Territory* const> defendList1 = player1->toDefend();
+  const std::span<Territory* const> defendList2 = player2->toDefend();
 
   std::cout << "Player 1 territories to defend (" << defendList1.size() << "):" << std::endl;
   for (const Territory* terr : defendList1) {
@@ -138,8 +135,8 @@ void testPlayers() {
   }
 
   // test toAttack method
-  const std::vector<Territory*> attackList1 = player1->toAttack();
-  const std::vector<Territory*> attackList2 = player2->toAttack();
+  const std::span<Territory* const> attackList1 = player1->toAttack();
+  const std::span<Territory* const> attackList2 = player2->toAttack();
 
   std::cout << "Player 1 territories to attack (" << attackList1.size() << "):" << std::endl;
   for (const Territory* terr : attackList1) {
@@ -165,6 +162,17 @@ void testPlayers() {
   std::cout << "Original Player 2: " << *player2 << std::endl;
   std::cout << "Assigned Player 2: " << *player2Assigned << std::endl;
 
+  // test move constructor and move assignment: the slot moves with the player and is released once
+  Player moveSource("Mover", deck);
+  const int movedSlot = moveSource.getSlot();
+  Player moved(std::move(moveSource));
+  std::cout << "Move constructor took the slot: " << (moved.getSlot() == movedSlot ? "yes" : "no")
+            << ", source slot: " << moveSource.getSlot() << std::endl;
+  Player moveTarget("Target", deck);
+  moveTarget = std::move(moved);
+  std::cout << "Move assignment took the slot: " << (moveTarget.getSlot() == movedSlot ? "yes" : "no")
+            << ", source slot: " << moved.getSlot() << std::endl;
+
   // ==================== Test 7: Card Playing ====================
   std::cout << "\n--- Test 7: Card Playing ---" << std::endl;
 
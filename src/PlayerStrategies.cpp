@@ -1,9 +1,15 @@
 #include "PlayerStrategies.h"
 #include "Cards.h"
+#include "Input.h"
 #include "Map.h"
 #include "Player.h"
+#include "Utility.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
 #include <vector>
 
 
@@ -34,6 +40,26 @@ std::string* PlayerStrategy::getStrategy() const {
   return strategy;
 }
 
+// --- FACTORY ---
+std::unique_ptr<PlayerStrategy> PlayerStrategy::create(const std::string& key, Player* play) {
+  if (key == PLAYER_STRATEGIES::HUMAN) return std::make_unique<HumanPlayerStrategy>(play);
+  if (key == PLAYER_STRATEGIES::AGGRESSIVE) return std::make_unique<AggressivePlayerStrategy>(play);
+  if (key == PLAYER_STRATEGIES::BENEVOLENT) return std::make_unique<BenevolentPlayerStrategy>(play);
+  if (key == PLAYER_STRATEGIES::NEUTRAL) return std::make_unique<NeutralPlayerStrategy>(play);
+  if (key == PLAYER_STRATEGIES::CHEATER) return std::make_unique<CheaterPlayerStrategy>(play);
+  if (key == PLAYER_STRATEGIES::MCTS) return std::make_unique<MCTSPlayerStrategy>(play);
+  return nullptr;
+}
+
+std::string PlayerStrategy::keyOf(const PlayerStrategy* strat) {
+  if (dynamic_cast<const HumanPlayerStrategy*>(strat)) return PLAYER_STRATEGIES::HUMAN;
+  if (dynamic_cast<const AggressivePlayerStrategy*>(strat)) return PLAYER_STRATEGIES::AGGRESSIVE;
+  if (dynamic_cast<const BenevolentPlayerStrategy*>(strat)) return PLAYER_STRATEGIES::BENEVOLENT;
+  if (dynamic_cast<const CheaterPlayerStrategy*>(strat)) return PLAYER_STRATEGIES::CHEATER;
+  if (dynamic_cast<const MCTSPlayerStrategy*>(strat)) return PLAYER_STRATEGIES::MCTS;
+  return PLAYER_STRATEGIES::NEUTRAL;
+}
+
 // --- STREAM INSERTION OPERATOR ---
 std::ostream& operator<<(std::ostream& os, const PlayerStrategy& strat) {
   os << "Player Strategy[" << (strat.strategy ? *strat.strategy : "Neutral Player") << "]" << std::endl;
@@ -67,7 +93,7 @@ void HumanPlayerStrategy::issueOrder() {
     Territory* target = nullptr;
 
     std::cout << "Enter the name of the territory to deploy armies to: ";
-    std::cin >> territoryName;
+    territoryName = Input::readToken();
 
     for (const auto terr : player->getTerritories()) {
       if (terr->getName() == territoryName) {
@@ -79,7 +105,7 @@ void HumanPlayerStrategy::issueOrder() {
     if (target) {
       int armies;
       std::cout << "Enter number of armies to deploy: ";
-      std::cin >> armies;
+      armies = Input::readInt();
 
       if (armies > 0 && armies <= player->getReinforcementPool()) {
         player->issueDeployOrder(target, armies);
@@ -100,13 +126,13 @@ void HumanPlayerStrategy::issueOrder() {
   }
 
   std::cout << "Enemy territories:\n";
-  for (const auto terr : this->toAttack()) {
+  for (const auto terr : player->toAttack()) {
     std::cout << " - " << terr->getName() << " (Armies: " << terr->getArmies() << ")\n";
   }
 
   std::string sourceName;
   std::cout << "Enter the name of the source territory for advance order (or 'skip' to skip): ";
-  std::cin >> sourceName;
+  sourceName = Input::readToken();
 
   if (sourceName != "skip") {
     Territory* source = nullptr;
@@ -122,8 +148,8 @@ void HumanPlayerStrategy::issueOrder() {
       Territory* target = nullptr;
 
       std::cout << "Enter the name of the target territory for advance order: ";
-      std::cin >> targetName;
-      for (const auto& terr : this->toAttack()) {
+      targetName = Input::readToken();
+      for (const auto& terr : player->toAttack()) {
         if (terr->getName() == targetName) {
           target = terr;
           break;
@@ -133,7 +159,7 @@ void HumanPlayerStrategy::issueOrder() {
       if (target) {
         int armies;
         std::cout << "Enter number of armies to advance: ";
-        std::cin >> armies;
+        armies = Input::readInt();
 
         if (armies > 0 && armies < source->getArmies()) {
           player->issueAdvanceOrder(source, target, armies);
@@ -155,17 +181,17 @@ void HumanPlayerStrategy::issueOrder() {
   if (hand->size() > 0) {
     std::cout << "You have the following cards in your hand:\n";
     for (size_t i = 0; i < hand->size(); i++) {
-      std::cout << i << ": " << hand->getCards()->at(i)->getType() << "\n";
+      std::cout << i << ": " << cardTypeName(hand->cardAt(i)) << "\n";
     }
 
     int cardIndex = -2;
     std::cout << "Enter the index of the card to play (-1 to skip): ";
     while (cardIndex < -1 || cardIndex >= hand->size()) {
-      std::cin >> cardIndex;
+      cardIndex = Input::readInt(-2);
     }
 
     if (cardIndex != -1) {
-      std::cout << "Played card: " << hand->getCards()->at(cardIndex)->getType() << "\n";
+      std::cout << "Played card: " << cardTypeName(hand->cardAt(cardIndex)) << "\n";
       player->playCard(cardIndex, player->getDeck());
     }
   }
@@ -208,7 +234,7 @@ AggressivePlayerStrategy& AggressivePlayerStrategy::operator=(const AggressivePl
 // --- STRATEGY MANAGEMENT ---
 void AggressivePlayerStrategy::issueOrder() {
   if (player->getReinforcementPool() > 0) {
-    std::vector<Territory*> defendList = this->toDefend();
+    const std::span<Territory* const> defendList = player->toDefend();
 
     if (!defendList.empty()) {
       // deploy to first territory in defend list
@@ -234,6 +260,16 @@ void AggressivePlayerStrategy::issueOrder() {
     }
   }
 
+  // further away, march armies one hop along a shortest path towards the strongest territory
+  if (const Map* map = strongest->getMap()) {
+    for (const auto terr : player->getTerritories()) {
+      if (terr == strongest || terr->getArmies() <= 1 || map->distanceBetween(terr, strongest) < 2) continue;
+
+      Territory* hop = map->nextHopTowards(terr, strongest);
+      if (hop && hop->getOwner() == player) player->issueAdvanceOrder(terr, hop, terr->getArmies() - 1);
+    }
+  }
+
   for (const auto adj : player->toAttack()) {
     const int armiesToAttack = strongest->getArmies() - 1; // leave 1 army behind
     if (armiesToAttack > 0) {
@@ -244,16 +280,10 @@ void AggressivePlayerStrategy::issueOrder() {
   }
 
   // priority 3: play cards if we have any
-  const Hand* hand = player->getHand();
-  if (hand->size() > 0) {
-    // play aggressive card if available
-    for (const auto card : *hand->getCards()) {
-      if (card->getType() == CARD_TYPES::BOMB) {
-        card->play(player, player->getOrders(), player->getDeck());
-        std::cout << "  Playing aggressive card: " << card->getType() << "\n";
-        break; // play only one card per turn
-      }
-    }
+  // play aggressive card if available, only one card per turn
+  if (player->getHand()->count(CardType::BOMB) > 0) {
+    std::cout << "  Playing aggressive card: " << CARD_TYPES::BOMB << "\n";
+    player->playCard(CardType::BOMB, player->getDeck());
   }
 
   player->setCanIssueOrder(false); // end turn after issuing
@@ -320,8 +350,8 @@ BenevolentPlayerStrategy& BenevolentPlayerStrategy::operator=(const BenevolentPl
 // --- STRATEGY MANAGEMENT ---
 void BenevolentPlayerStrategy::issueOrder() {
   // deploy troops to the weakest territories
-  const std::vector<Territory*> defendList = this->toDefend();
-  const std::vector<Territory*> territories = player->getTerritories();
+  const std::span<Territory* const> defendList = player->toDefend();
+  const std::vector<Territory*>& territories = player->getTerritories();
 
   if (player->getReinforcementPool() > 0) {
     if (!defendList.empty()) {
@@ -384,15 +414,11 @@ void BenevolentPlayerStrategy::issueOrder() {
   // benevolent player only plays cards that don't involve attacking
   // priority 3: play cards if we have any
   const Hand* hand = player->getHand();
-  if (hand->size() > 0) {
-    // play non-aggressive card if available
-    for (const auto card : *hand->getCards()) {
-      if (card->getType() != CARD_TYPES::BOMB) {
-        card->play(player, player->getOrders(), player->getDeck());
-        std::cout << "  Playing non-aggressive card: " << card->getType() << "\n";
-        break; // play only one card per turn
-      }
-    }
+  if (hand->size() > hand->count(CardType::BOMB)) {
+    // play non-aggressive card if available, the first one past the bombs
+    const CardType card = hand->cardAt(hand->count(CardType::BOMB));
+    std::cout << "  Playing non-aggressive card: " << cardTypeName(card) << "\n";
+    player->playCard(card, player->getDeck()); // only one card per turn
   }
 
   player->setCanIssueOrder(false); // end turn after issuing
@@ -400,7 +426,7 @@ void BenevolentPlayerStrategy::issueOrder() {
 
 std::vector<Territory*> BenevolentPlayerStrategy::toDefend() {
   std::vector<Territory*> defendList = player->getTerritories();
-  std::ranges::sort(defendList, std::less{});
+  std::ranges::sort(defendList, std::less{}, &Territory::getId); // map order, not addresses, so a seeded game replays
   return defendList;
 }
 
@@ -435,7 +461,7 @@ NeutralPlayerStrategy& NeutralPlayerStrategy::operator=(const NeutralPlayerStrat
 // --- STRATEGY MANAGEMENT ---
 void NeutralPlayerStrategy::issueOrder() {
   if (player->getReinforcementPool() > 0) {
-    const std::vector<Territory*> defendList = this->toDefend();
+    const std::span<Territory* const> defendList = player->toDefend();
 
     if (!defendList.empty()) {
       // deploy to first territory in defend list
@@ -492,7 +518,7 @@ CheaterPlayerStrategy& CheaterPlayerStrategy::operator=(const CheaterPlayerStrat
 // --- STRATEGY MANAGEMENT ---
 void CheaterPlayerStrategy::issueOrder() {
   if (player->getReinforcementPool() > 0) {
-    const std::vector<Territory*> defendList = this->toDefend();
+    const std::span<Territory* const> defendList = player->toDefend();
 
     if (!defendList.empty()) {
       // deploy to first territory in defend list
@@ -531,3 +557,272 @@ std::vector<Territory*> CheaterPlayerStrategy::toAttack() {
   }
   return attackList;
 }
+
+
+// ==================== MCTSPlayerStrategy Class Implementation ====================
+namespace {
+  constexpr int MCTS_MAX_ACTIONS = 8; // branching factor per tree node
+  constexpr int MCTS_HORIZON = 6;     // simulated rounds per playout
+  constexpr double MCTS_EXPLORATION = 0.7;
+
+  struct MCTSNode {
+    SimAction action;
+    int parent = -1;
+    std::vector<int> children;
+    double value = 0.0;
+    int visits = 0;
+    bool expanded = false;
+  };
+
+  /**
+   * Grows one open-loop UCT tree: nodes are action sequences, and the state is re-simulated from the
+   * root on every iteration so that battle randomness is sampled rather than stored in the tree.
+   */
+  void runSearchWorker(
+    const SimTopology& topo, const SimState& root, int slot, long long maxIterations,
+    std::chrono::steady_clock::time_point deadline, bool timed, unsigned int seed,
+    std::vector<MCTSNode>& tree, long long& playouts
+  ) {
+    Simulation::Rng rng(seed);
+    SimState state;
+
+    tree.clear();
+    tree.push_back(MCTSNode{});
+
+    for (long long iter = 0; maxIterations <= 0 || iter < maxIterations; iter++) {
+      if (timed && (iter & 31) == 0 && std::chrono::steady_clock::now() >= deadline) break;
+
+      state = root; // reuses the buffers of the previous playout
+      int node = 0, depth = 0;
+
+      // selection + expansion
+      while (depth < MCTS_HORIZON && !Simulation::isTerminal(state)) {
+        if (!tree[node].expanded) {
+          for (const SimAction& action : Simulation::candidateActions(topo, state, slot, MCTS_MAX_ACTIONS)) {
+            tree[node].children.push_back(static_cast<int>(tree.size()));
+            tree.push_back(MCTSNode{action, node});
+          }
+          tree[node].expanded = true;
+        }
+        if (tree[node].children.empty()) break;
+
+        int best = -1;
+        double bestScore = -1.0;
+        const double logVisits = std::log(static_cast<double>(tree[node].visits) + 1.0);
+
+        for (const int child : tree[node].children) {
+          const MCTSNode& cand = tree[child];
+          if (cand.visits == 0) {
+            best = child;
+            break;
+          }
+
+          const double score = cand.value / cand.visits + MCTS_EXPLORATION * std::sqrt(logVisits / cand.visits);
+          if (score > bestScore) {
+            best = child;
+            bestScore = score;
+          }
+        }
+
+        Simulation::playRound(topo, state, slot, tree[best].action, rng);
+        node = best;
+        depth++;
+
+        if (tree[node].visits == 0) break; // new leaf, continue with a rollout
+      }
+
+      // rollout with the default policy
+      while (depth < MCTS_HORIZON && !Simulation::isTerminal(state)) {
+        Simulation::playRound(topo, state, slot, Simulation::defaultAction(topo, state, slot, rng), rng);
+        depth++;
+      }
+
+      // backpropagation
+      const double reward = Simulation::evaluate(state, slot);
+      for (int n = node; n >= 0; n = tree[n].parent) {
+        tree[n].visits++;
+        tree[n].value += reward;
+      }
+      playouts++;
+    }
+  }
+}
+
+MCTSPlayerStrategy::MCTSPlayerStrategy(Player* play, int iters, int budgetMs, int thr) :
+  PlayerStrategy(play, new std::string("MCTS Player Strategy")),
+  iterations(iters),
+  timeBudgetMs(budgetMs),
+  threads(thr),
+  topology(nullptr),
+  plannedAction(),
+  plannedArmies(0),
+  lastPlayouts(0) {}
+
+MCTSPlayerStrategy::MCTSPlayerStrategy(const MCTSPlayerStrategy& other) :
+  PlayerStrategy(other),
+  iterations(other.iterations),
+  timeBudgetMs(other.timeBudgetMs),
+  threads(other.threads),
+  topology(nullptr),
+  plannedAction(other.plannedAction),
+  plannedArmies(other.plannedArmies),
+  lastPlayouts(0) {}
+
+MCTSPlayerStrategy& MCTSPlayerStrategy::operator=(const MCTSPlayerStrategy& other) {
+  if (this != &other) {
+    PlayerStrategy::operator=(other);
+
+    iterations = other.iterations;
+    timeBudgetMs = other.timeBudgetMs;
+    threads = other.threads;
+    topology.reset(); // rebuilt lazily for this player's map
+    plannedAction = other.plannedAction;
+    plannedArmies = other.plannedArmies;
+    lastPlayouts = 0;
+  }
+  return *this;
+}
+
+MCTSPlayerStrategy::~MCTSPlayerStrategy() = default;
+
+// --- GETTERS ---
+long long MCTSPlayerStrategy::getLastPlayouts() const {
+  return lastPlayouts;
+}
+
+// --- STRATEGY MANAGEMENT ---
+void MCTSPlayerStrategy::issueOrder() {
+  const std::vector<Territory*>& territories = player->getTerritories();
+  if (territories.empty()) {
+    player->setReinforcementPool(0);
+    player->setCanIssueOrder(false);
+    return;
+  }
+
+  if (player->getReinforcementPool() > 0 || plannedAction.deployTo < 0) {
+    // (re)build the flat topology when first playing or when moved to another map
+    if (!topology || topology->indexOf(territories.front()) < 0) {
+      topology = std::make_unique<SimTopology>(territories);
+    }
+
+    std::vector<Player*> slots{player};
+    const SimState root = Simulation::capture(*topology, slots);
+    plannedAction = search(root, 0);
+
+    Territory* target = plannedAction.deployTo >= 0 ? topology->getTerritory(plannedAction.deployTo) : nullptr;
+    const int armiesToDeploy = player->getReinforcementPool();
+    plannedArmies = target ? target->getArmies() + armiesToDeploy : 0;
+
+    if (target && armiesToDeploy > 0) {
+      std::cout << player->getName() << " issuing deploy order: " << armiesToDeploy
+                << " armies to " << target->getName() << "\n";
+      player->issueDeployOrder(target, armiesToDeploy);
+    }
+
+    player->setReinforcementPool(0);
+    if (armiesToDeploy > 0) return;
+  }
+
+  // advance with everything but one army, as planned during the search
+  if (plannedAction.from >= 0 && plannedAction.to >= 0) {
+    Territory* source = topology->getTerritory(plannedAction.from);
+    Territory* target = topology->getTerritory(plannedAction.to);
+    const int armiesToMove = plannedArmies - 1;
+
+    if (player->ownsTerritory(source) && armiesToMove > 0) {
+      std::cout << player->getName() << " issuing advance order: " << armiesToMove << " armies from "
+                << source->getName() << " to " << target->getName() << "\n";
+      player->issueAdvanceOrder(source, target, armiesToMove);
+    }
+  }
+
+  plannedAction = SimAction{};
+  player->setCanIssueOrder(false); // end turn after issuing
+}
+
+std::vector<Territory*> MCTSPlayerStrategy::toDefend() {
+  // border territories first, weakest first
+  std::vector<Territory*> defendList = player->getTerritories();
+  auto isBorder = [this](const Territory* terr) {
+    return std::ranges::any_of(terr->getAdjTerritories(), [this](const Territory* adj) {
+      return adj->getOwner() != player;
+    });
+  };
+
+  std::ranges::stable_sort(defendList, [&isBorder](const Territory* a, const Territory* b) {
+    const bool borderA = isBorder(a), borderB = isBorder(b);
+    if (borderA != borderB) return borderA;
+    return a->getArmies() < b->getArmies();
+  });
+  return defendList;
+}
+
+std::vector<Territory*> MCTSPlayerStrategy::toAttack() {
+  std::vector<Territory*> attackList;
+  std::unordered_set<Territory*> seen;
+
+  for (const auto terr : player->getTerritories()) {
+    for (auto adj : terr->getAdjTerritories()) {
+      if (adj->getOwner() != player && seen.insert(adj).second) {
+        attackList.push_back(adj);
+      }
+    }
+  }
+  return attackList;
+}
+
+// --- UTILITY ---
+/**
+ * root-parallel search: every thread grows its own tree from the same root and the root
+ * statistics are summed, so no locking is needed during playouts
+ */
+SimAction MCTSPlayerStrategy::search(const SimState& root, int slot) {
+  const auto start = std::chrono::steady_clock::now();
+  const auto deadline = start + std::chrono::milliseconds(timeBudgetMs);
+  const bool timed = timeBudgetMs > 0;
+
+  const int threadCount = threads > 0 ? threads : Parallelism::available();
+  const long long perThread = iterations > 0 ? std::max(1LL, static_cast<long long>(iterations) / threadCount) : 0;
+  if (!timed && perThread == 0) return SimAction{};
+
+  std::vector<std::vector<MCTSNode>> trees(threadCount);
+  std::vector<long long> playouts(threadCount, 0);
+  std::vector<std::thread> workers;
+  const unsigned int seed = GameRandom::get()(); // each search draws from the game, so a seeded game replays
+
+  for (int t = 0; t < threadCount; t++) {
+    workers.emplace_back(runSearchWorker, std::cref(*topology), std::cref(root), slot, perThread,
+                         deadline, timed, seed + t, std::ref(trees[t]), std::ref(playouts[t]));
+  }
+  for (auto& worker : workers) worker.join();
+
+  // merge root children (identical across threads since every tree starts from the same root)
+  const std::vector<int>& rootChildren = trees[0][0].children;
+  SimAction best;
+  int bestVisits = -1;
+
+  for (size_t c = 0; c < rootChildren.size(); c++) {
+    int visits = 0;
+    for (const auto& tree : trees) {
+      if (c < tree[0].children.size()) visits += tree[tree[0].children[c]].visits;
+    }
+    if (visits > bestVisits) {
+      best = trees[0][rootChildren[c]].action;
+      bestVisits = visits;
+    }
+  }
+
+  // no playout finished within the budget: fall back to the top-ranked candidate
+  if (bestVisits <= 0) {
+    const auto actions = Simulation::candidateActions(*topology, root, slot, MCTS_MAX_ACTIONS);
+    best = actions.empty() ? SimAction{} : actions.front();
+  }
+
+  lastPlayouts = 0;
+  for (const long long count : playouts) lastPlayouts += count;
+
+  const auto elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  std::cout << player->getName() << " (MCTS) ran " << lastPlayouts << " playouts on " << threadCount
+            << " threads in " << static_cast<long long>(elapsedMs) << " ms\n";
+  return best;
+}
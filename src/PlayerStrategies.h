@@ -1,7 +1,9 @@
 #pragma once
 #include "Map.h"
+#include "Simulation.h"
 
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -19,6 +21,10 @@ public:
   // getters
   std::string* getStrategy() const;
 
+  // factory
+  static std::unique_ptr<PlayerStrategy> create(const std::string& key, Player* play); // nullptr for unknown keys
+  static std::string keyOf(const PlayerStrategy* strat);
+
   // strategy management
   virtual void issueOrder() = 0;
   virtual std::vector<Territory*> toDefend() = 0;
@@ -97,6 +103,39 @@ public:
   std::vector<Territory*> toAttack() override;
 };
 
+/**
+ * Monte Carlo tree search player: runs open-loop UCT playouts on a compact SimState copy of the map,
+ * using all cores (a single thread when its game already runs on a pool worker), and plays the deploy/advance pair with the most visits.
+ */
+class MCTSPlayerStrategy : public PlayerStrategy {
+private:
+  int iterations;                        // playouts per decision (0 = bounded by time only)
+  int timeBudgetMs;                      // wall-clock budget per decision (0 = bounded by iterations only)
+  int threads;                           // search threads (0 = all cores, or 1 on a pool worker)
+  std::unique_ptr<SimTopology> topology; // flat map graph, built on first decision
+  SimAction plannedAction;               // decision taken during the deploy step, advanced on the next call
+  int plannedArmies;                     // armies expected on the advance source once deploys have executed
+  long long lastPlayouts;                // playouts run by the last search
+
+public:
+  MCTSPlayerStrategy(Player* play, int iters = 2000, int budgetMs = 0, int thr = 0);
+  MCTSPlayerStrategy(const MCTSPlayerStrategy& other); // copy constructor
+  MCTSPlayerStrategy& operator=(const MCTSPlayerStrategy& other); // assignment operator
+  ~MCTSPlayerStrategy() override; // destructor
+
+  // getters
+  long long getLastPlayouts() const;
+
+  // strategy management
+  void issueOrder() override;
+  std::vector<Territory*> toDefend() override;
+  std::vector<Territory*> toAttack() override;
+
+private:
+  // utility
+  SimAction search(const SimState& root, int slot);
+};
+
 // namespaces
 namespace PLAYER_STRATEGIES {
   constexpr auto HUMAN = "human";
@@ -104,6 +143,7 @@ namespace PLAYER_STRATEGIES {
   constexpr auto BENEVOLENT = "benevolent";
   constexpr auto NEUTRAL = "neutral";
   constexpr auto CHEATER = "cheater";
+  constexpr auto MCTS = "mcts";
 }
 
 // free function
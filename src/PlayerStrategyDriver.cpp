@@ -3,8 +3,10 @@
 #include "Orders.h"
 #include "Player.h"
 #include "PlayerStrategies.h"
+#include "Utility.h"
 
 #include <iostream>
+#include <thread>
 #include <vector>
 
 /**
@@ -91,10 +93,10 @@ void testDifferentStrategiesDifferentBehavior() {
   Player* cheaterPlayer = new Player("Cheater Player", deck);
 
   // assign strategies
-  aggressivePlayer->setStrategy(new AggressivePlayerStrategy(aggressivePlayer));
-  benevolentPlayer->setStrategy(new BenevolentPlayerStrategy(benevolentPlayer));
-  neutralPlayer->setStrategy(new NeutralPlayerStrategy(neutralPlayer));
-  cheaterPlayer->setStrategy(new CheaterPlayerStrategy(cheaterPlayer));
+  aggressivePlayer->setStrategy(std::make_unique<AggressivePlayerStrategy>(aggressivePlayer));
+  benevolentPlayer->setStrategy(std::make_unique<BenevolentPlayerStrategy>(benevolentPlayer));
+  neutralPlayer->setStrategy(std::make_unique<NeutralPlayerStrategy>(neutralPlayer));
+  cheaterPlayer->setStrategy(std::make_unique<CheaterPlayerStrategy>(cheaterPlayer));
 
   // setup territories for each player
   const std::vector<std::unique_ptr<Territory>>& territories = map->getTerritories();
@@ -137,34 +139,34 @@ void testDifferentStrategiesDifferentBehavior() {
   cheaterPlayer->setReinforcementPool(10);
 
   // give cards to players
-  aggressivePlayer->addCard(new BombCard());
-  aggressivePlayer->addCard(new ReinforcementCard());
-  aggressivePlayer->addCard(new AirliftCard());
+  aggressivePlayer->addCard(CardType::BOMB);
+  aggressivePlayer->addCard(CardType::REINFORCEMENT);
+  aggressivePlayer->addCard(CardType::AIRLIFT);
 
-  benevolentPlayer->addCard(new BombCard());
-  benevolentPlayer->addCard(new ReinforcementCard());
-  benevolentPlayer->addCard(new AirliftCard());
+  benevolentPlayer->addCard(CardType::BOMB);
+  benevolentPlayer->addCard(CardType::REINFORCEMENT);
+  benevolentPlayer->addCard(CardType::AIRLIFT);
 
-  neutralPlayer->addCard(new BombCard());
-  neutralPlayer->addCard(new ReinforcementCard());
-  neutralPlayer->addCard(new AirliftCard());
+  neutralPlayer->addCard(CardType::BOMB);
+  neutralPlayer->addCard(CardType::REINFORCEMENT);
+  neutralPlayer->addCard(CardType::AIRLIFT);
 
-  cheaterPlayer->addCard(new BombCard());
-  cheaterPlayer->addCard(new ReinforcementCard());
-  cheaterPlayer->addCard(new AirliftCard());
+  cheaterPlayer->addCard(CardType::BOMB);
+  cheaterPlayer->addCard(CardType::REINFORCEMENT);
+  cheaterPlayer->addCard(CardType::AIRLIFT);
 
   // Test 1: Aggressive Player Behavior
   std::cout << "--- Aggressive Player Behavior ---\n";
   std::cout << "Before issuing orders:\n";
   aggressivePlayer->displayInfo();
 
-  const std::vector<Territory*> aggressiveDefend = aggressivePlayer->toDefend();
+  const std::span<Territory* const> aggressiveDefend = aggressivePlayer->toDefend();
   std::cout << "\nAggressive toDefend() returns strongest territory:\n";
   for (const auto terr : aggressiveDefend) {
     std::cout << "  - " << terr->getName() << " (Armies: " << terr->getArmies() << ")\n";
   }
 
-  const std::vector<Territory*> aggressiveAttack = aggressivePlayer->toAttack();
+  const std::span<Territory* const> aggressiveAttack = aggressivePlayer->toAttack();
   std::cout << "\nAggressive toAttack() returns adjacent enemy territories:\n";
   for (const auto terr : aggressiveAttack) {
     std::cout << "  - " << terr->getName() << " (Owner: " << terr->getOwner()->getName() << ")\n";
@@ -172,7 +174,7 @@ void testDifferentStrategiesDifferentBehavior() {
 
   // issue orders
   std::cout << "\nIssuing orders for Aggressive Player:\n";
-  while (*(aggressivePlayer->getCanIssueOrder())) {
+  while (aggressivePlayer->getCanIssueOrder()) {
     aggressivePlayer->issueOrder();
   }
   std::cout << "\nOrderList after issuing orders: " << *(aggressivePlayer->getOrders());
@@ -182,14 +184,14 @@ void testDifferentStrategiesDifferentBehavior() {
   std::cout << "Before issuing orders:\n";
   benevolentPlayer->displayInfo();
 
-  const std::vector<Territory*> benevolentDefend = benevolentPlayer->toDefend();
+  const std::span<Territory* const> benevolentDefend = benevolentPlayer->toDefend();
   std::cout << "\nBenevolent toDefend() returns weakest territories first:\n";
   for (const auto terr : benevolentDefend) {
     std::cout << "  - " << terr->getName() << " (Armies: " << terr->getArmies() << ")\n";
   }
 
   std::cout << "\nIssuing orders for Benevolent Player:\n";
-  while (*(benevolentPlayer->getCanIssueOrder())) {
+  while (benevolentPlayer->getCanIssueOrder()) {
     benevolentPlayer->issueOrder();
   }
   std::cout << "\nOrderList after issuing orders: " << *(benevolentPlayer->getOrders());
@@ -200,7 +202,7 @@ void testDifferentStrategiesDifferentBehavior() {
   neutralPlayer->displayInfo();
 
   std::cout << "\nIssuing orders for Neutral Player:\n";
-  while (*(neutralPlayer->getCanIssueOrder())) {
+  while (neutralPlayer->getCanIssueOrder()) {
     neutralPlayer->issueOrder();
   }
   std::cout << "\nOrderList after issuing orders: " << *(neutralPlayer->getOrders());
@@ -211,7 +213,7 @@ void testDifferentStrategiesDifferentBehavior() {
   cheaterPlayer->displayInfo();
 
   std::cout << "\nIssuing orders for Cheater Player:\n";
-  while (*(cheaterPlayer->getCanIssueOrder())) {
+  while (cheaterPlayer->getCanIssueOrder()) {
     cheaterPlayer->issueOrder();
   }
   std::cout << "\nOrderList after issuing orders: " << *(cheaterPlayer->getOrders());
@@ -250,22 +252,22 @@ void testDynamicStrategyChange() {
 
   // start with aggressive strategy
   std::cout << "--- Initial Strategy: Aggressive ---\n";
-  player->setStrategy(new AggressivePlayerStrategy(player));
+  player->setStrategy(std::make_unique<AggressivePlayerStrategy>(player));
   player->displayInfo();
 
-  std::vector<Territory*> defendList = player->toDefend();
+  std::span<Territory* const> defendList = player->toDefend();
   std::cout << "\nWith Aggressive strategy, toDefend() prioritizes:\n";
   for (const auto terr : defendList) {
     std::cout << "  - " << terr->getName() << " (Armies: " << terr->getArmies() << ")\n";
   }
 
   player->issueOrder();
-  const int ordersAfterAggressive = player->getOrders()->orders->size();
+  const int ordersAfterAggressive = player->getOrders()->orders.size();
   std::cout << "Orders issued: " << ordersAfterAggressive << "\n";
 
   // change to benevolent strategy
   std::cout << "\n--- Changing Strategy to: Benevolent ---\n";
-  player->setStrategy(new BenevolentPlayerStrategy(player));
+  player->setStrategy(std::make_unique<BenevolentPlayerStrategy>(player));
   player->setReinforcementPool(15); // reset reinforcements for next test
 
   defendList = player->toDefend();
@@ -275,25 +277,25 @@ void testDynamicStrategyChange() {
   }
 
   player->issueOrder();
-  const int ordersAfterBenevolent = player->getOrders()->orders->size();
+  const int ordersAfterBenevolent = player->getOrders()->orders.size();
   std::cout << "Orders issued: " << ordersAfterBenevolent << "\n";
 
   // change to neutral strategy
   std::cout << "\n--- Changing Strategy to: Neutral ---\n";
-  player->setStrategy(new NeutralPlayerStrategy(player));
+  player->setStrategy(std::make_unique<NeutralPlayerStrategy>(player));
   player->setReinforcementPool(10);
 
   player->issueOrder();
-  const int ordersAfterNeutral = player->getOrders()->orders->size();
+  const int ordersAfterNeutral = player->getOrders()->orders.size();
   std::cout << "Orders issued: " << ordersAfterNeutral << "\n";
 
   // change to cheater strategy
   std::cout << "\n--- Changing Strategy to: Cheater ---\n";
-  player->setStrategy(new CheaterPlayerStrategy(player));
+  player->setStrategy(std::make_unique<CheaterPlayerStrategy>(player));
   player->setReinforcementPool(10);
 
   player->issueOrder();
-  const int ordersAfterCheater = player->getOrders()->orders->size();
+  const int ordersAfterCheater = player->getOrders()->orders.size();
   std::cout << "Orders issued: " << ordersAfterCheater << " (includes cheat order)\n";
 
   std::cout << "\nTest 2 PASSED: Strategy can be changed dynamically during play\n";
@@ -322,17 +324,15 @@ void testHumanVsComputerStrategies() {
   setupPlayersWithTerritories(humanPlayer, computerPlayer, map);
 
   // set strategies
-  humanPlayer->setStrategy(new HumanPlayerStrategy(humanPlayer));
-  computerPlayer->setStrategy(new AggressivePlayerStrategy(computerPlayer));
+  humanPlayer->setStrategy(std::make_unique<HumanPlayerStrategy>(humanPlayer));
+  computerPlayer->setStrategy(std::make_unique<AggressivePlayerStrategy>(computerPlayer));
 
   humanPlayer->setReinforcementPool(10);
   computerPlayer->setReinforcementPool(10);
 
   // add a card to each player's hand
-  Card* bombCard1 = new BombCard();
-  Card* reinforcementCard = new ReinforcementCard();
-  humanPlayer->addCard(bombCard1);
-  computerPlayer->addCard(reinforcementCard);
+  humanPlayer->addCard(CardType::BOMB);
+  computerPlayer->addCard(CardType::REINFORCEMENT);
 
   // demonstrate computer player (automatic)
   std::cout << "--- Computer Player (Automatic Decision Making) ---\n";
@@ -341,7 +341,7 @@ void testHumanVsComputerStrategies() {
 
   std::cout << "\nComputer player automatically issues orders:\n";
   computerPlayer->issueOrder();
-  std::cout << "Computer player issued " << computerPlayer->getOrders()->orders->size()
+  std::cout << "Computer player issued " << computerPlayer->getOrders()->orders.size()
             << " orders automatically\n";
 
   // demonstrate human player (user interaction)
@@ -350,19 +350,19 @@ void testHumanVsComputerStrategies() {
   humanPlayer->displayInfo();
 
   std::cout << "\nHuman player issuing orders (user input required):\n";
-  while (*(humanPlayer->getCanIssueOrder())) {
+  while (humanPlayer->getCanIssueOrder()) {
     humanPlayer->issueOrder();
-    std::cout << "Human player issued " << humanPlayer->getOrders()->orders->size()
+    std::cout << "Human player issued " << humanPlayer->getOrders()->orders.size()
               << " orders based on user input\n";
   }
 
   // switch human to computer strategy for automated testing
   std::cout << "\n--- Converting Human to Computer Strategy for Testing ---\n";
-  humanPlayer->setStrategy(new BenevolentPlayerStrategy(humanPlayer));
+  humanPlayer->setStrategy(std::make_unique<BenevolentPlayerStrategy>(humanPlayer));
 
   std::cout << "Human player now using Benevolent (computer) strategy\n";
   humanPlayer->issueOrder();
-  std::cout << "Player issued " << humanPlayer->getOrders()->orders->size()
+  std::cout << "Player issued " << humanPlayer->getOrders()->orders.size()
             << " orders automatically\n";
 
   std::cout << "\nTest 3 PASSED: Strategy pattern enables both human and computer players\n";
@@ -374,6 +374,57 @@ void testHumanVsComputerStrategies() {
   delete computerPlayer;
 }
 
+/**
+ * Test function to demonstrate the MCTS player searching on a compact copy of the game state
+ */
+void testMCTSStrategy() {
+  std::cout << "\n========================================\n";
+  std::cout << "Test 4: Monte Carlo Tree Search Strategy\n";
+  std::cout << "========================================\n\n";
+
+  // create test environment
+  Map* map = createTestMap();
+  Deck* deck = new Deck();
+
+  Player* mctsPlayer = new Player("MCTS Player", deck);
+  Player* aggressivePlayer = new Player("Aggressive Player", deck);
+  setupPlayersWithTerritories(mctsPlayer, aggressivePlayer, map);
+
+  // 4000 playouts spread over all cores
+  auto owned = std::make_unique<MCTSPlayerStrategy>(mctsPlayer, 4000);
+  auto* mcts = owned.get();
+  mctsPlayer->setStrategy(std::move(owned));
+  aggressivePlayer->setStrategy(std::make_unique<AggressivePlayerStrategy>(aggressivePlayer));
+  mctsPlayer->setReinforcementPool(5);
+
+  std::cout << "MCTS player issuing orders:\n";
+  while (mctsPlayer->getCanIssueOrder()) {
+    mctsPlayer->issueOrder();
+  }
+
+  std::cout << "\nPlayouts in last search: " << mcts->getLastPlayouts() << "\n";
+  std::cout << "OrderList after issuing orders: " << *(mctsPlayer->getOrders());
+
+  // the same decision made on a pool worker (sweeps, the game server) searches on that worker's thread only
+  int pooledThreads = 0;
+  std::thread worker([&] {
+    const Parallelism::PoolScope pooled;
+    pooledThreads = Parallelism::available();
+    mctsPlayer->setReinforcementPool(5);
+    mctsPlayer->setCanIssueOrder(true);
+    mctsPlayer->issueOrder();
+  });
+  worker.join();
+  std::cout << "\nThreads available to a search on a pool worker: " << pooledThreads << "\n";
+  std::cout << "\nTest 4 PASSED: MCTS strategy issued orders from simulated playouts\n";
+
+  // cleanup
+  delete map;
+  delete deck;
+  delete mctsPlayer;
+  delete aggressivePlayer;
+}
+
 /**
  * Main test driver function that runs all strategy tests
  */
@@ -393,6 +444,9 @@ void testPlayerStrategies() {
     // test 3: human vs computer strategies
     testHumanVsComputerStrategies();
 
+    // test 4: monte carlo tree search strategy
+    testMCTSStrategy();
+
     std::cout << "\n========================================\n";
     std::cout << "    ALL TESTS COMPLETED SUCCESSFULLY\n";
     std::cout << "========================================\n\n";
@@ -0,0 +1,165 @@
+#include "Profiler.h"
+#include "Tracer.h"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <ranges>
+#include <unordered_map>
+
+namespace {
+  // heterogeneous lookup, so looking a name up never allocates
+  struct NameHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+  };
+
+  // node-based maps keep stat addresses stable for the scopes holding them
+  using StatTable = std::unordered_map<std::string, ProfileStat, NameHash, std::equal_to<>>;
+  thread_local std::array<StatTable, static_cast<std::size_t>(ProfileCategory::COUNT)> tables;
+
+  void sortStats(std::vector<ProfileStat>& stats) {
+    std::ranges::sort(stats, [](const ProfileStat& a, const ProfileStat& b) {
+      if (a.category != b.category) return a.category < b.category;
+      return a.totalNs > b.totalNs;
+    });
+  }
+}
+
+
+// ==================== Profiler::Scope Class Implementation ====================
+Profiler::Scope::Scope(ProfileCategory category, std::string_view name) :
+  stat(statFor(category, name)) {
+  if constexpr (AllocationTracker::isEnabled()) {
+    startAllocs = AllocationTracker::current();
+    savedPeak = AllocationTracker::beginPeak();
+  }
+  start = Clock::now();
+}
+
+Profiler::Scope::~Scope() {
+  const Clock::time_point end = Clock::now();
+  const std::int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  stat->minNs = stat->count == 0 ? ns : std::min(stat->minNs, ns);
+  stat->maxNs = std::max(stat->maxNs, ns);
+  stat->totalNs += ns;
+  stat->count++;
+
+  if constexpr (AllocationTracker::isEnabled()) {
+    const AllocationCounters now = AllocationTracker::current();
+    stat->allocations += now.allocations - startAllocs.allocations;
+    stat->allocatedBytes += now.bytes - startAllocs.bytes;
+    stat->peakBytes = std::max(stat->peakBytes, AllocationTracker::endPeak(savedPeak) - startAllocs.liveBytes);
+  }
+
+  if (Tracer::isActive()) Tracer::complete(categoryName(stat->category), stat->name, start, end);
+}
+
+
+// ==================== Profiler Class Implementation ====================
+// --- STATS API ---
+std::vector<ProfileStat> Profiler::getStats() {
+  std::vector<ProfileStat> stats;
+  for (const StatTable& table : tables) {
+    for (const auto& stat : table | std::views::values) {
+      if (stat.count > 0) stats.push_back(stat);
+    }
+  }
+
+  sortStats(stats);
+  return stats;
+}
+
+void Profiler::reset() {
+  for (StatTable& table : tables) {
+    for (auto& stat : table | std::views::values) {
+      stat.count = stat.totalNs = stat.minNs = stat.maxNs = 0;
+      stat.allocations = stat.allocatedBytes = stat.peakBytes = 0;
+    }
+  }
+}
+
+void Profiler::merge(std::vector<ProfileStat>& totals, const std::vector<ProfileStat>& stats) {
+  for (const ProfileStat& stat : stats) {
+    auto it = std::ranges::find_if(totals, [&stat](const ProfileStat& total) {
+      return total.category == stat.category && total.name == stat.name;
+    });
+    if (it == totals.end()) {
+      totals.push_back(stat);
+      continue;
+    }
+
+    it->minNs = it->count == 0 ? stat.minNs : std::min(it->minNs, stat.minNs);
+    it->maxNs = std::max(it->maxNs, stat.maxNs);
+    it->totalNs += stat.totalNs;
+    it->count += stat.count;
+    it->allocations += stat.allocations;
+    it->allocatedBytes += stat.allocatedBytes;
+    it->peakBytes = std::max(it->peakBytes, stat.peakBytes);
+  }
+  sortStats(totals);
+}
+
+void Profiler::report(std::ostream& os) {
+  report(os, getStats());
+}
+
+void Profiler::report(std::ostream& os, const std::vector<ProfileStat>& stats) {
+  if (stats.empty()) return;
+
+  auto ms = [](std::int64_t ns) { return static_cast<double>(ns) / 1e6; };
+
+  os << "\nProfile (ms):\n";
+  os << std::left << std::setw(10) << "category" << std::setw(32) << "name" << std::right
+     << std::setw(10) << "count" << std::setw(12) << "total" << std::setw(10) << "mean"
+     << std::setw(10) << "min" << std::setw(10) << "max" << "\n";
+
+  const auto flags = os.flags();
+  os << std::fixed << std::setprecision(3);
+  for (const ProfileStat& stat : stats) {
+    os << std::left << std::setw(10) << categoryName(stat.category) << std::setw(32) << stat.name << std::right
+       << std::setw(10) << stat.count << std::setw(12) << ms(stat.totalNs)
+       << std::setw(10) << ms(stat.totalNs) / static_cast<double>(stat.count)
+       << std::setw(10) << ms(stat.minNs) << std::setw(10) << ms(stat.maxNs) << "\n";
+  }
+
+  if (AllocationTracker::isEnabled()) {
+    auto kib = [](std::int64_t bytes) { return static_cast<double>(bytes) / 1024.0; };
+
+    os << "\nAllocations (KiB):\n";
+    os << std::left << std::setw(10) << "category" << std::setw(32) << "name" << std::right
+       << std::setw(12) << "allocs" << std::setw(12) << "per run" << std::setw(14) << "bytes"
+       << std::setw(12) << "per run" << std::setw(12) << "peak" << "\n";
+
+    for (const ProfileStat& stat : stats) {
+      const auto runs = static_cast<double>(stat.count);
+      os << std::left << std::setw(10) << categoryName(stat.category) << std::setw(32) << stat.name << std::right
+         << std::setw(12) << stat.allocations << std::setw(12) << static_cast<double>(stat.allocations) / runs
+         << std::setw(14) << kib(stat.allocatedBytes) << std::setw(12) << kib(stat.allocatedBytes) / runs
+         << std::setw(12) << kib(stat.peakBytes) << "\n";
+    }
+  }
+  os.flags(flags);
+}
+
+// --- UTILITY ---
+const char* Profiler::categoryName(ProfileCategory category) {
+  switch (category) {
+    case ProfileCategory::GAME: return "game";
+    case ProfileCategory::PHASE: return "phase";
+    case ProfileCategory::ORDER: return "order";
+    case ProfileCategory::STRATEGY: return "strategy";
+    default: return "unknown";
+  }
+}
+
+ProfileStat* Profiler::statFor(ProfileCategory category, std::string_view name) {
+  StatTable& table = tables[static_cast<std::size_t>(category)];
+
+  auto it = table.find(name);
+  if (it == table.end()) {
+    it = table.emplace(std::string(name), ProfileStat{category, std::string(name)}).first;
+  }
+  return &it->second;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "AllocationTracker.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * What a timed scope belongs to; stats are aggregated per (category, name).
+ */
+enum class ProfileCategory : std::uint8_t { GAME, PHASE, ORDER, STRATEGY, COUNT };
+
+/**
+ * Aggregated timings of one (category, name) pair.
+ */
+struct ProfileStat {
+  ProfileCategory category = ProfileCategory::GAME;
+  std::string name;
+  std::int64_t count = 0;
+  std::int64_t totalNs = 0;
+  std::int64_t minNs = 0;
+  std::int64_t maxNs = 0;
+  std::int64_t allocations = 0; // heap activity inside the scope, counted when RISK_ALLOC_TRACKING is on
+  std::int64_t allocatedBytes = 0;
+  std::int64_t peakBytes = 0;   // highest live heap growth above the scope's start, over all its runs
+};
+
+
+/**
+ * The Profiler class aggregates scoped steady_clock timings per phase, order type and strategy.
+ * Stats are kept per thread, so engines running on different threads never contend on them.
+ * Scopes are opened with the PROFILE_SCOPE macro, which compiles to nothing unless RISK_PROFILING is defined
+ * (cmake -DRISK_PROFILING=ON, the default).
+ */
+class Profiler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Times its own lifetime and adds it to the stat it was opened on.
+   */
+  class Scope {
+  private:
+    ProfileStat* stat;
+    Clock::time_point start;
+    AllocationCounters startAllocs;
+    std::int64_t savedPeak = 0;
+
+  public:
+    Scope(ProfileCategory category, std::string_view name);
+    Scope(const Scope& other) = delete;
+    Scope& operator=(const Scope& other) = delete;
+    ~Scope(); // destructor, records the elapsed time
+  };
+
+  // stats api
+  static std::vector<ProfileStat> getStats(); // grouped by category, slowest total first
+  static void reset();                        // zeroes every stat; call outside of any open scope
+  static void report(std::ostream& os);      // timings, plus allocations when they are tracked
+  static void report(std::ostream& os, const std::vector<ProfileStat>& stats);
+
+  // stats gathered on other threads: folds stats into totals, keeping the getStats order
+  static void merge(std::vector<ProfileStat>& totals, const std::vector<ProfileStat>& stats);
+
+  // utility
+  static constexpr bool isEnabled() {
+#ifdef RISK_PROFILING
+    return true;
+#else
+    return false;
+#endif
+  }
+  static const char* categoryName(ProfileCategory category);
+
+private:
+  static ProfileStat* statFor(ProfileCategory category, std::string_view name);
+};
+
+// scoped timer macros
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef RISK_PROFILING
+#define PROFILE_SCOPE(category, name) const Profiler::Scope PROFILE_CONCAT(profileScope, __LINE__)((category), (name))
+#else
+#define PROFILE_SCOPE(category, name) static_cast<void>(0)
+#endif
@@ -0,0 +1,306 @@
+#include "Simulation.h"
+#include "Map.h"
+#include "Player.h"
+
+#include <algorithm>
+#include <queue>
+
+
+// ==================== SimTopology Class Implementation ====================
+SimTopology::SimTopology(std::span<Territory* const> seeds) {
+  // discover the whole (connected) map by bfs from the seed territories
+  std::queue<Territory*> queue;
+  for (Territory* seed : seeds) {
+    if (seed && !indices.contains(seed)) {
+      indices[seed] = static_cast<int>(territories.size());
+      territories.push_back(seed);
+      queue.push(seed);
+    }
+  }
+
+  while (!queue.empty()) {
+    const Territory* terr = queue.front();
+    queue.pop();
+
+    for (Territory* adj : terr->getAdjTerritories()) {
+      if (adj && !indices.contains(adj)) {
+        indices[adj] = static_cast<int>(territories.size());
+        territories.push_back(adj);
+        queue.push(adj);
+      }
+    }
+  }
+
+  // flatten adjacency into csr form
+  adjOffsets.reserve(territories.size() + 1);
+  adjOffsets.push_back(0);
+  for (const Territory* terr : territories) {
+    for (const Territory* adj : terr->getAdjTerritories()) {
+      adjList.push_back(indices.at(adj));
+    }
+    adjOffsets.push_back(static_cast<int>(adjList.size()));
+  }
+
+  // flatten continent membership
+  std::unordered_map<const Continent*, int> continentIndices;
+  std::vector<const Continent*> continents;
+  continentOf.assign(territories.size(), -1);
+
+  for (size_t i = 0; i < territories.size(); i++) {
+    const Continent* cont = territories[i]->getContinent();
+    if (!cont) continue;
+
+    auto [it, inserted] = continentIndices.try_emplace(cont, static_cast<int>(continents.size()));
+    if (inserted) continents.push_back(cont);
+    continentOf[i] = it->second;
+  }
+
+  continentOffsets.push_back(0);
+  for (const Continent* cont : continents) {
+    for (const Territory* terr : cont->getTerritories()) {
+      const auto it = indices.find(terr);
+      if (it != indices.end()) continentMembers.push_back(it->second);
+    }
+    continentOffsets.push_back(static_cast<int>(continentMembers.size()));
+    continentBonus.push_back(cont->getBonus());
+  }
+}
+
+// --- GETTERS ---
+int SimTopology::getTerritoryCount() const {
+  return static_cast<int>(territories.size());
+}
+
+int SimTopology::getContinentCount() const {
+  return static_cast<int>(continentBonus.size());
+}
+
+int SimTopology::getContinentBonus(int cont) const {
+  return continentBonus[cont];
+}
+
+Territory* SimTopology::getTerritory(int idx) const {
+  return territories[idx];
+}
+
+int SimTopology::indexOf(const Territory* terr) const {
+  const auto it = indices.find(terr);
+  return it != indices.end() ? it->second : -1;
+}
+
+// --- GRAPH QUERIES ---
+std::span<const int> SimTopology::neighbours(int idx) const {
+  return std::span(adjList).subspan(adjOffsets[idx], adjOffsets[idx + 1] - adjOffsets[idx]);
+}
+
+std::span<const int> SimTopology::continentTerritories(int cont) const {
+  return std::span(continentMembers).subspan(
+    continentOffsets[cont], continentOffsets[cont + 1] - continentOffsets[cont]
+  );
+}
+
+
+// ==================== Simulation Class Implementation ====================
+// --- STATE CAPTURE ---
+SimState Simulation::capture(const SimTopology& topo, std::vector<Player*>& slots) {
+  SimState state;
+  const int count = topo.getTerritoryCount();
+  state.owner.assign(count, SimState::NO_OWNER);
+  state.armies.assign(count, 0);
+
+  for (int i = 0; i < count; i++) {
+    const Territory* terr = topo.getTerritory(i);
+    state.armies[i] = terr->getArmies();
+
+    Player* owner = terr->getOwner();
+    if (!owner) continue;
+
+    // assign slots in order of first appearance
+    auto it = std::ranges::find(slots, owner);
+    if (it == slots.end()) {
+      if (slots.size() >= SimState::NO_OWNER) continue;
+      slots.push_back(owner);
+      it = slots.end() - 1;
+    }
+    state.owner[i] = static_cast<std::uint8_t>(it - slots.begin());
+  }
+
+  state.playerCount = static_cast<int>(slots.size());
+  return state;
+}
+
+// --- RULES ---
+int Simulation::reinforcements(const SimTopology& topo, const SimState& state, int slot) {
+  int reinforcement = std::max(3, territoryCount(state, slot) / 3);
+
+  // add bonuses for fully owned continents
+  for (int cont = 0; cont < topo.getContinentCount(); cont++) {
+    const auto members = topo.continentTerritories(cont);
+    const bool owned = !members.empty() && std::ranges::all_of(members, [&](int idx) {
+      return state.owner[idx] == slot;
+    });
+    if (owned) reinforcement += topo.getContinentBonus(cont);
+  }
+
+  return reinforcement;
+}
+
+bool Simulation::isAlive(const SimState& state, int slot) {
+  return std::ranges::find(state.owner, slot) != state.owner.end();
+}
+
+int Simulation::territoryCount(const SimState& state, int slot) {
+  return static_cast<int>(std::ranges::count(state.owner, slot));
+}
+
+void Simulation::resolveAdvance(SimState& state, int from, int to, int armies, Rng& rng) {
+  if (armies <= 0) return;
+  state.armies[from] -= armies;
+
+  // friendly move
+  if (state.owner[from] == state.owner[to]) {
+    state.armies[to] += armies;
+    return;
+  }
+
+  // same odds as OrderAdvance: attackers kill 60%, defenders kill 70%
+  std::binomial_distribution attackRoll(armies, 0.6);
+  std::binomial_distribution defenseRoll(state.armies[to], 0.7);
+
+  int attackers = armies - defenseRoll(rng);
+  const int defenders = state.armies[to] - attackRoll(rng);
+
+  if (defenders <= 0) {
+    state.owner[to] = state.owner[from];
+    state.armies[to] = std::max(attackers, 1);
+  } else {
+    state.armies[to] = defenders;
+    if (attackers > 0) state.armies[from] += attackers;
+  }
+}
+
+// --- ACTIONS ---
+std::vector<SimAction> Simulation::candidateActions(
+  const SimTopology& topo, const SimState& state, int slot, int maxActions
+) {
+  struct Scored {
+    SimAction action;
+    int score;
+  };
+
+  std::vector<Scored> attacks;
+  const int reinforcement = reinforcements(topo, state, slot);
+  int holdTarget = -1, holdMargin = 0;
+
+  for (int idx = 0; idx < topo.getTerritoryCount(); idx++) {
+    if (state.owner[idx] != slot) continue;
+
+    int strongestEnemy = -1;
+    for (const int adj : topo.neighbours(idx)) {
+      if (state.owner[adj] == slot) continue;
+
+      strongestEnemy = std::max(strongestEnemy, state.armies[adj]);
+      attacks.push_back({{idx, idx, adj}, state.armies[idx] + reinforcement - state.armies[adj]});
+    }
+
+    // the most threatened border territory is the defensive option
+    if (strongestEnemy >= 0) {
+      const int margin = state.armies[idx] - strongestEnemy;
+      if (holdTarget < 0 || margin < holdMargin) {
+        holdTarget = idx;
+        holdMargin = margin;
+      }
+    }
+  }
+
+  std::vector<SimAction> actions;
+  if (holdTarget < 0) {
+    // no borders left: just reinforce anything owned
+    const auto it = std::ranges::find(state.owner, slot);
+    if (it != state.owner.end()) actions.push_back({static_cast<int>(it - state.owner.begin()), -1, -1});
+    return actions;
+  }
+
+  actions.push_back({holdTarget, -1, -1});
+
+  // keep the most promising attacks
+  std::ranges::sort(attacks, std::greater{}, &Scored::score);
+  for (const auto& [action, score] : attacks) {
+    if (static_cast<int>(actions.size()) >= maxActions) break;
+    actions.push_back(action);
+  }
+
+  return actions;
+}
+
+SimAction Simulation::defaultAction(const SimTopology& topo, const SimState& state, int slot, Rng& rng) {
+  std::vector<int> borders;
+  int strongest = -1;
+
+  for (int idx = 0; idx < topo.getTerritoryCount(); idx++) {
+    if (state.owner[idx] != slot) continue;
+
+    for (const int adj : topo.neighbours(idx)) {
+      if (state.owner[adj] != slot) {
+        borders.push_back(idx);
+        if (strongest < 0 || state.armies[idx] > state.armies[strongest]) strongest = idx;
+        break;
+      }
+    }
+  }
+
+  if (borders.empty()) return {};
+
+  // mostly stack on the strongest border, sometimes explore another one
+  std::uniform_int_distribution<int> pick(0, static_cast<int>(borders.size()) - 1);
+  std::bernoulli_distribution explore(0.3);
+  const int deployTo = explore(rng) ? borders[pick(rng)] : strongest;
+
+  // attack the weakest neighbouring enemy when the odds are favourable
+  int weakest = -1;
+  for (const int adj : topo.neighbours(deployTo)) {
+    if (state.owner[adj] != slot && (weakest < 0 || state.armies[adj] < state.armies[weakest])) weakest = adj;
+  }
+
+  const int available = state.armies[deployTo] + reinforcements(topo, state, slot) - 1;
+  if (weakest >= 0 && available > state.armies[weakest]) return {deployTo, deployTo, weakest};
+  return {deployTo, -1, -1};
+}
+
+void Simulation::playRound(const SimTopology& topo, SimState& state, int slot, const SimAction& action, Rng& rng) {
+  thread_local std::vector<SimAction> actions;
+  actions.assign(state.playerCount, SimAction{});
+
+  // every alive player decides and deploys on the same snapshot, like the real issue phase
+  for (int play = 0; play < state.playerCount; play++) {
+    if (!isAlive(state, play)) continue;
+
+    actions[play] = play == slot ? action : defaultAction(topo, state, play, rng);
+    const int reinforcement = reinforcements(topo, state, play);
+
+    if (actions[play].deployTo >= 0 && state.owner[actions[play].deployTo] == play) {
+      state.armies[actions[play].deployTo] += reinforcement;
+    }
+  }
+
+  // then execute the advances in player order
+  for (int play = 0; play < state.playerCount; play++) {
+    const SimAction& act = actions[play];
+    if (act.from < 0 || act.to < 0 || state.owner[act.from] != play) continue;
+    resolveAdvance(state, act.from, act.to, state.armies[act.from] - 1, rng);
+  }
+}
+
+// --- EVALUATION ---
+double Simulation::evaluate(const SimState& state, int slot) {
+  if (state.owner.empty()) return 0.0;
+  return static_cast<double>(territoryCount(state, slot)) / static_cast<double>(state.owner.size());
+}
+
+bool Simulation::isTerminal(const SimState& state) {
+  int alive = 0;
+  for (int play = 0; play < state.playerCount; play++) {
+    if (isAlive(state, play) && ++alive > 1) return false;
+  }
+  return true;
+}
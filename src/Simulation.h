@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+class Territory;
+
+/**
+ * The SimTopology class is a flat, index-based copy of a map's graph.
+ * It is built once from live territories and then shared read-only between simulation threads.
+ */
+class SimTopology {
+private:
+  std::vector<Territory*> territories;           // index -> live territory
+  std::unordered_map<const Territory*, int> indices;
+  std::vector<int> adjOffsets;                   // csr offsets into adjList
+  std::vector<int> adjList;                      // neighbour indices
+  std::vector<int> continentOf;                  // continent index per territory
+  std::vector<int> continentOffsets;             // csr offsets into continentMembers
+  std::vector<int> continentMembers;             // territory indices per continent
+  std::vector<int> continentBonus;
+
+public:
+  explicit SimTopology(std::span<Territory* const> seeds);
+
+  // getters
+  int getTerritoryCount() const;
+  int getContinentCount() const;
+  int getContinentBonus(int cont) const;
+  Territory* getTerritory(int idx) const;
+  int indexOf(const Territory* terr) const;
+
+  // graph queries
+  std::span<const int> neighbours(int idx) const;
+  std::span<const int> continentTerritories(int cont) const;
+};
+
+
+/**
+ * Action taken by one player during one simulated round:
+ * deploy the whole reinforcement pool on deployTo, then advance from -> to (to == -1 means hold).
+ */
+struct SimAction {
+  int deployTo = -1;
+  int from = -1;
+  int to = -1;
+
+  bool operator==(const SimAction& other) const = default;
+};
+
+
+/**
+ * The SimState struct is a compact game position: one owner slot and one army count per territory.
+ * Copy-assigning into an existing state reuses its buffers, so cloning it per playout is cheap.
+ */
+struct SimState {
+  static constexpr std::uint8_t NO_OWNER = 0xFF;
+
+  std::vector<std::uint8_t> owner;  // player slot per territory
+  std::vector<std::int32_t> armies; // armies per territory
+  int playerCount = 0;
+};
+
+
+/**
+ * Stateless game rules over SimTopology/SimState used for fast playouts.
+ */
+class Simulation {
+public:
+  using Rng = std::mt19937;
+
+  // state capture
+  static SimState capture(const SimTopology& topo, std::vector<Player*>& slots);
+
+  // rules
+  static int reinforcements(const SimTopology& topo, const SimState& state, int slot);
+  static bool isAlive(const SimState& state, int slot);
+  static int territoryCount(const SimState& state, int slot);
+  static void resolveAdvance(SimState& state, int from, int to, int armies, Rng& rng);
+
+  // actions
+  static std::vector<SimAction> candidateActions(const SimTopology& topo, const SimState& state, int slot, int maxActions);
+  static SimAction defaultAction(const SimTopology& topo, const SimState& state, int slot, Rng& rng);
+  static void playRound(const SimTopology& topo, SimState& state, int slot, const SimAction& action, Rng& rng);
+
+  // evaluation
+  static double evaluate(const SimState& state, int slot);
+  static bool isTerminal(const SimState& state);
+};
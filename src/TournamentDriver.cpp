@@ -1,7 +1,18 @@
+#include "AllocationTracker.h"
 #include "CommandProcessing.h"
 #include "GameEngine.h"
+#include "Input.h"
+#include "Profiler.h"
+#include "TournamentExport.h"
+#include "TournamentScheduler.h"
+#include "TournamentSpec.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
-#include <limits>
+#include <map>
+#include <sstream>
+#include <vector>
 
 // tournament -M Canada/Canada.map, London/London.map, France/France.map -P Aggressive, Benevolent, Neutral, Cheater -G 4 -D 30
 // tournament -M Canada/Canada.map, London/London.map, France/France.map -P Aggressive, Aggressive, Neutral -G 1 -D 180
@@ -18,19 +29,13 @@ void testTournament() {
   std::cout << "TOURNAMENT MODE TEST DRIVER\n";
   std::cout << std::string(60, '=') << "\n\n";
 
-  // clear any leftover input buffer state from previous tests
-  // NOTE: YOU MUST COMMENT OUT BOTH LINES IF YOU RUN THIS AS A STAND-ALONE FUNCTION
-  std::cin.clear();
-  std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
   // select input mode
   std::cout << "Select input mode: " << std::endl;
   std::cout << "1. Console input (-console)" << std::endl;
   std::cout << "2. File input (-file <filename>)" << std::endl;
   std::cout << "Enter choice: ";
 
-  std::string choice;
-  std::getline(std::cin, choice);
+  const std::string choice = Input::readLine();
 
   CommandProcessor* processor = nullptr;
 
@@ -58,7 +63,7 @@ void testTournament() {
 
   // transition to start state (required for tournament command)
   std::cout << "Step 1: Transitioning to 'start' state...\n";
-  engine.transitionState("start");
+  engine.transitionState(GameState::START);
   std::cout << "Current game state: " << engine.getCurrentStateName() << "\n\n";
 
   // get tournament command from processor
@@ -105,3 +110,445 @@ void testTournament() {
   // free memory
   delete processor;
 }
+
+/**
+ * Test driver for tournament checkpointing (-C <file>)
+ * Demonstrates that:
+ * 1. the results matrix is checkpointed after every game
+ * 2. re-running the same tournament skips the games already played
+ * 3. the game in flight is saved after every turn and can be loaded back
+ * 4. rows exported after the last checkpoint are dropped on resume, so every game has exactly one row
+ */
+void testTournamentCheckpoint() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "TOURNAMENT CHECKPOINT TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  const std::string checkpoint = (std::filesystem::temp_directory_path() / "risk_tournament.ckpt").string();
+  const std::string csvFile = (std::filesystem::temp_directory_path() / "risk_tournament_rows.csv").string();
+  const std::string tournamentCmd =
+    "tournament -M Canada/Canada.map -P Aggressive, Benevolent -G 2 -D 10 -C " + checkpoint + " -O " + csvFile;
+  std::filesystem::remove(checkpoint);
+  std::filesystem::remove(csvFile);
+  auto countLines = [&csvFile]() {
+    std::ifstream in(csvFile);
+    std::string line;
+    int lines = 0;
+    while (std::getline(in, line)) { ++lines; }
+    return lines;
+  };
+
+  GameEngine engine;
+  CommandProcessor processor;
+  engine.transitionState(GameState::START);
+  std::cout << "Command: " << tournamentCmd << "\n";
+  std::cout << "Validation: " << (processor.validate(tournamentCmd, &engine) ? "PASSED" : "FAILED") << "\n";
+
+  // 1. first run plays every game and leaves the results checkpoint behind
+  std::cout << "\nStep 1: First run...\n";
+  engine.executeTournament(tournamentCmd);
+  std::cout << "Checkpoint written: " << (std::filesystem::exists(checkpoint) ? "yes" : "no") << "\n";
+
+  // 2. a restarted run of the same tournament only replays unfinished games (none here); a row exported by a
+  // run that crashed before checkpointing it is cut away
+  std::cout << "\nStep 2: Restarted run...\n";
+  std::ofstream(csvFile, std::ios::app) << "Canada/Canada.map,2,0,Aggressive,1,0.0\n";
+  engine.executeTournament(tournamentCmd);
+  std::cout << "Csv lines after resume (header + 2 games): " << countLines() << "\n";
+
+  // 3. per-turn checkpoint of a game in flight
+  std::cout << "\nStep 3: Per-turn game checkpoint...\n";
+  const std::string gameCheckpoint = checkpoint + ".game";
+  engine.setCheckpointFile(gameCheckpoint);
+  engine.playTournamentGame("Canada/Canada.map", {"aggressive", "benevolent"}, 10, 345);
+  engine.setCheckpointFile("");
+
+  GameEngine resumed;
+  const bool loaded = resumed.loadGame(gameCheckpoint);
+  std::cout << "Last turn checkpoint loaded: " << (loaded ? "yes" : "no")
+            << ", resumes at turn " << resumed.getCurrentTurn() << "\n";
+
+  std::filesystem::remove(checkpoint);
+  std::filesystem::remove(gameCheckpoint);
+  std::filesystem::remove(csvFile);
+
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "END OF TOURNAMENT CHECKPOINT TEST\n";
+  std::cout << std::string(60, '=') << "\n";
+}
+
+/**
+ * Test driver for structured tournament export (-O <files>)
+ * Demonstrates that one tournament streams per-game records to csv, json lines and columnar files
+ */
+void testTournamentExport() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "TOURNAMENT EXPORT TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  const std::filesystem::path dir = std::filesystem::temp_directory_path();
+  const std::string csvFile = (dir / "risk_results.csv").string();
+  const std::string jsonFile = (dir / "risk_results.jsonl").string();
+  const std::string columnarFile = (dir / "risk_results.col").string();
+  for (const auto& file : {csvFile, jsonFile, columnarFile}) { std::filesystem::remove(file); }
+
+  const std::string tournamentCmd = "tournament -M Canada/Canada.map -P Aggressive, Benevolent, Neutral -G 2 -D 10 -O " +
+                                    csvFile + ", " + jsonFile + ", " + columnarFile;
+
+  GameEngine engine;
+  CommandProcessor processor;
+  engine.transitionState(GameState::START);
+  std::cout << "Command: " << tournamentCmd << "\n";
+  std::cout << "Validation: " << (processor.validate(tournamentCmd, &engine) ? "PASSED" : "FAILED") << "\n";
+  std::cout << "Bad extension rejected: "
+            << (processor.validate("tournament -M a.map -P A, B -G 1 -D 10 -O results.txt", &engine) ? "no" : "yes") << "\n";
+
+  engine.executeTournament(tournamentCmd);
+
+  // show what the analytics pipeline receives
+  for (const auto& file : {csvFile, jsonFile}) {
+    std::cout << "\n--- " << file << " ---\n";
+    std::ifstream in(file);
+    std::string line;
+    while (std::getline(in, line)) { std::cout << line << "\n"; }
+  }
+  std::cout << "\n--- " << columnarFile << " ---\n";
+  std::cout << std::filesystem::file_size(columnarFile) << " bytes of columnar row groups\n";
+
+  for (const auto& file : {csvFile, jsonFile, columnarFile}) { std::filesystem::remove(file); }
+
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "END OF TOURNAMENT EXPORT TEST\n";
+  std::cout << std::string(60, '=') << "\n";
+}
+
+/**
+ * Test driver for tournament spec files (-F <specfile>)
+ * Demonstrates that a spec sweeps maps x lineups x turn limits x seeds without expanding the jobs,
+ * that bad specs are rejected with their line, and that a small sweep plays on several threads
+ */
+void testTournamentSpec() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "TOURNAMENT SPEC TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  // 1. a sweep far too large to list: every pair and triple of four strategies over a thousand seeds
+  std::istringstream large(
+    "# every pair and triple\n"
+    "maps = Canada/Canada.map, France/France.map\n"
+    "strategies = aggressive, benevolent, neutral, cheater\n"
+    "players = 2-3\n"
+    "lineup = cheater, cheater\n"
+    "turns = 10-50/20\n"
+    "seeds = 1-1000\n"
+  );
+  std::string error;
+  const auto sweep = TournamentSpec::parse(large, "", error);
+  if (!sweep) {
+    std::cout << "1. Large spec rejected: " << error << "\n";
+    return;
+  }
+  std::cout << "1. Large spec: " << sweep->getMaps().size() << " maps, " << sweep->getLineups().size()
+            << " lineups (6 pairs + 4 triples + 1 explicit), " << sweep->getTurns().size() << " turn limits, "
+            << sweep->getSeeds().size() << " seeds = " << sweep->jobCount() << " games\n";
+
+  for (const std::uint64_t index : {std::uint64_t{0}, std::uint64_t{1}, std::uint64_t{3000}, sweep->jobCount() - 1}) {
+    const TournamentJob job = sweep->job(index);
+    std::cout << "   job " << index << ": " << job.map << ", seed " << job.seed << ", " << job.maxTurns << " turns,";
+    for (const std::string& strategy : job.lineup) std::cout << " " << strategy;
+    std::cout << "\n";
+  }
+
+  // 2. mistakes are reported with their line
+  std::cout << "\n2. Rejected specs:\n";
+  for (const char* bad : {
+         "maps = Canada/Canada.map\nstrategies = aggressive, human\nturns = 10\n",
+         "maps = Canada/Canada.map\nlineup = aggressive\nturns = 10\n",
+         "maps = Nowhere/Nowhere.map\n",
+         "maps = Canada/Canada.map\nstrategies = aggressive, cheater\nturns = 20-10\n",
+         "maps = Canada/Canada.map\nstrategies = aggressive, cheater\n",
+       }) {
+    std::istringstream in(bad);
+    std::cout << "   " << (TournamentSpec::parse(in, "", error) ? "accepted" : error) << "\n";
+  }
+
+  // 3. a small sweep through the tournament command, on two threads
+  const std::filesystem::path dir = std::filesystem::temp_directory_path();
+  const std::string specFile = (dir / "risk_sweep.spec").string();
+  const std::string csvFile = (dir / "risk_sweep.csv").string();
+  std::filesystem::remove(csvFile);
+  {
+    std::ofstream spec(specFile);
+    spec << "maps = Canada/Canada.map\n"
+         << "strategies = aggressive, benevolent, cheater\n"
+         << "players = 2-3\n"
+         << "turns = 10\n"
+         << "games = 3\n"
+         << "workers = 2\n"
+         << "output = " << csvFile << "\n";
+  }
+
+  const std::string tournamentCmd = "tournament -F " + specFile;
+  GameEngine engine;
+  CommandProcessor processor;
+  engine.transitionState(GameState::START);
+  std::cout << "\n3. Command: " << tournamentCmd << "\n";
+  std::cout << "Validation: " << (processor.validate(tournamentCmd, &engine) ? "PASSED" : "FAILED") << "\n";
+  engine.executeTournament(tournamentCmd);
+
+  // pairs and triples share one header, whichever finished first
+  std::ifstream in(csvFile);
+  std::string header;
+  std::getline(in, header);
+  int rows = 0;
+  bool sameWidth = true;
+  for (std::string line; std::getline(in, line); rows++) {
+    sameWidth = sameWidth && std::ranges::count(line, ',') == std::ranges::count(header, ',');
+  }
+  std::cout << "Rows exported: " << rows << " (expected 12), all as wide as the header: " << (sameWidth ? "YES" : "NO") << "\n";
+
+  std::filesystem::remove(specFile);
+  std::filesystem::remove(csvFile);
+
+  // 4. a seed decides its game, whatever else runs beside it
+  const std::string jsonFile = (dir / "risk_sweep.jsonl").string();
+  std::istringstream replayText(
+    "maps = Canada/Canada.map\n"
+    "strategies = aggressive, benevolent, cheater\n"
+    "players = 2\n"
+    "turns = 15\n"
+    "seeds = 1-4\n"
+    "output = " + jsonFile + "\n"
+  );
+  const auto replay = TournamentSpec::parse(replayText, "", error);
+  auto outcomes = [&](int workers) {
+    std::filesystem::remove(jsonFile);
+    TournamentSweep::run(*replay, workers);
+
+    // by game number, without the wall time
+    std::map<std::string, std::string> games;
+    std::ifstream results(jsonFile);
+    for (std::string line; std::getline(results, line);) {
+      const std::size_t wall = line.find(",\"wall_ms\":");
+      line.erase(wall, line.find(",\"players\":") - wall);
+      games[line.substr(0, line.find(",\"seed\":"))] = line;
+    }
+    return games;
+  };
+  const auto once = outcomes(1), again = outcomes(1), parallel = outcomes(4);
+  std::filesystem::remove(jsonFile);
+  std::cout << "\n4. Replayed " << once.size() << " games: same on one worker " << (once == again ? "YES" : "NO")
+            << ", same on four workers " << (once == parallel ? "YES" : "NO") << "\n";
+
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "END OF TOURNAMENT SPEC TEST\n";
+  std::cout << std::string(60, '=') << "\n";
+}
+
+/**
+ * Test driver for the tournament scheduler
+ * Demonstrates that games are costed from their map and lineup, that a mixed sweep starts its long games first,
+ * and that every worker's share of the work is reported
+ */
+void testTournamentScheduler() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "TOURNAMENT SCHEDULER TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  // 1. estimates: a passive lineup plays to the turn limit, a cheater ends the game early, bigger maps cost more
+  std::cout << "1. Estimated cost of a 30 turn game:\n";
+  for (const int territories : {20, 80}) {
+    for (const std::vector<std::string>& lineup : std::vector<std::vector<std::string>>{
+           {"benevolent", "neutral"}, {"aggressive", "benevolent"}, {"aggressive", "cheater"}
+         }) {
+      TournamentJob job;
+      job.lineup = lineup;
+      job.maxTurns = 30;
+      std::cout << "   " << territories << " territories, " << lineup[0] << " vs " << lineup[1] << ": "
+                << TournamentScheduler::estimateCost(job, territories) << "\n";
+    }
+  }
+
+  // 2. a sweep where a static split would leave one thread with every long game
+  std::istringstream specText(
+    "maps = Canada/Canada.map, France/France.map\n"
+    "lineup = aggressive, cheater\n"
+    "lineup = benevolent, neutral\n"
+    "turns = 40\n"
+    "games = 6\n"
+  );
+  std::string error;
+  const auto spec = TournamentSpec::parse(specText, "", error);
+  if (!spec) {
+    std::cout << "Spec rejected: " << error << "\n";
+    return;
+  }
+
+  // the first worker to ask pulls the window, so its queue opens with the longest game
+  TournamentScheduler scheduler(*spec, 3);
+  const std::optional<TournamentJob> first = scheduler.take(0);
+  std::cout << "\n2. First game handed out: " << (first ? first->lineup[0] + " vs " + first->lineup[1] + " on " + first->map : "none")
+            << "\n";
+
+  std::cout << "\n3. Sweep of " << spec->jobCount() << " games on 3 workers:\n";
+  const SweepSummary summary = TournamentSweep::run(*spec, 3);
+  TournamentSweep::report(*spec, summary, std::cout);
+
+  std::uint64_t games = 0;
+  for (const WorkerStats& worker : summary.workers) games += worker.games;
+  std::cout << "Every game played once: " << (games == spec->jobCount() && summary.games == games ? "YES" : "NO") << "\n";
+
+  // 4. many more seeds than fit in a window: every window still holds both mixes and starts the long ones first
+  std::istringstream manyText(
+    "maps = Canada/Canada.map\n"
+    "lineup = aggressive, cheater\n"
+    "lineup = benevolent, neutral\n"
+    "turns = 40\n"
+    "seeds = 1-200\n"
+  );
+  const auto many = TournamentSpec::parse(manyText, "", error);
+  TournamentScheduler dealer(*many, 2);
+  const std::size_t window = TournamentScheduler::JOBS_PER_WORKER * 2;
+
+  // two workers taking turns empty each window before the next one is pulled
+  std::vector<bool> order; // true for a long game, in the order they were handed out
+  for (int worker = 0; const auto job = dealer.take(worker); worker = 1 - worker) {
+    order.push_back(job->lineup[0] == "benevolent");
+  }
+
+  int windows = 0, longFirst = 0;
+  for (std::size_t begin = 0; begin < order.size(); begin += window) {
+    const auto first = order.begin() + begin, last = order.begin() + std::min(order.size(), begin + window);
+    windows++;
+    if (std::is_sorted(first, last, std::greater{}) && *first && !*(last - 1)) longFirst++;
+  }
+  std::cout << "\n4. " << order.size() << " games in " << windows << " windows of " << window
+            << ", long games handed out first in " << longFirst << "\n";
+
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "END OF TOURNAMENT SCHEDULER TEST\n";
+  std::cout << std::string(60, '=') << "\n";
+}
+
+/**
+ * Test driver for the profiling timers
+ * Demonstrates that a tournament aggregates timings per phase, order type and strategy,
+ * and that the same numbers are available through the stats api
+ */
+void testProfiler() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "PROFILER TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  if (!Profiler::isEnabled()) {
+    std::cout << "Profiling is compiled out (configure with -DRISK_PROFILING=ON to enable it)\n";
+    return;
+  }
+
+  GameEngine engine;
+  engine.transitionState(GameState::START);
+  engine.executeTournament("tournament -M Canada/Canada.map -P Aggressive, Benevolent, Cheater -G 2 -D 20");
+
+  // the tournament summary printed the table; read the same stats back programmatically
+  std::cout << "\nStats API:\n";
+  for (const ProfileStat& stat : Profiler::getStats()) {
+    if (stat.category == ProfileCategory::ORDER || stat.category == ProfileCategory::STRATEGY) {
+      std::cout << Profiler::categoryName(stat.category) << " " << stat.name << ": " << stat.count << " calls, "
+                << static_cast<double>(stat.totalNs) / 1e6 << " ms\n";
+    }
+  }
+
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "END OF PROFILER TEST\n";
+  std::cout << std::string(60, '=') << "\n";
+}
+
+/**
+ * Test driver for chrome trace export (-T <file>)
+ * Demonstrates that turns, phases, order execution and strategy calls are written as trace events
+ * that chrome://tracing or ui.perfetto.dev can open
+ */
+void testTracer() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "TRACE EXPORT TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  if (!Profiler::isEnabled()) {
+    std::cout << "Tracing needs the profiling timers (configure with -DRISK_PROFILING=ON to enable it)\n";
+    return;
+  }
+
+  const std::string traceFile = (std::filesystem::temp_directory_path() / "risk_trace.json").string();
+  const std::string tournamentCmd = "tournament -M Canada/Canada.map -P Aggressive, Benevolent -G 1 -D 10 -T " + traceFile;
+
+  GameEngine engine;
+  CommandProcessor processor;
+  engine.transitionState(GameState::START);
+  std::cout << "Command: " << tournamentCmd << "\n";
+  std::cout << "Validation: " << (processor.validate(tournamentCmd, &engine) ? "PASSED" : "FAILED") << "\n";
+
+  engine.executeTournament(tournamentCmd);
+
+  // count the events per kind, as a viewer would show them
+  std::ifstream in(traceFile);
+  std::string line;
+  int complete = 0, instant = 0, turns = 0, orders = 0;
+  while (std::getline(in, line)) {
+    if (line.find("\"ph\":\"X\"") != std::string::npos) complete++;
+    if (line.find("\"ph\":\"i\"") != std::string::npos) instant++;
+    if (line.find("\"name\":\"turn\"") != std::string::npos) turns++;
+    if (line.find("\"cat\":\"order\"") != std::string::npos) orders++;
+  }
+  std::cout << "\n" << traceFile << ": " << complete << " begin/end events (" << turns << " turns, "
+            << orders << " order executions) and " << instant << " notification events\n";
+
+  std::filesystem::remove(traceFile);
+
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "END OF TRACE EXPORT TEST\n";
+  std::cout << std::string(60, '=') << "\n";
+}
+
+/**
+ * Test driver for allocation tracking
+ * Demonstrates that heap allocations and bytes are attributed to games, turns and phases,
+ * with a high-water mark for each
+ */
+void testAllocationTracking() {
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "ALLOCATION TRACKING TEST DRIVER\n";
+  std::cout << std::string(60, '=') << "\n\n";
+
+  if (!AllocationTracker::isEnabled()) {
+    std::cout << "Allocation tracking is compiled out (configure with -DRISK_ALLOC_TRACKING=ON to enable it)\n";
+    return;
+  }
+
+  // 1. the counters see a known allocation
+  const AllocationCounters before = AllocationTracker::current();
+  const auto* block = new std::vector<int>(1000);
+  const AllocationCounters during = AllocationTracker::current();
+  delete block;
+  const AllocationCounters after = AllocationTracker::current();
+  std::cout << "1. vector of 1000 ints: " << (during.allocations - before.allocations) << " allocations, "
+            << (during.bytes - before.bytes) << " bytes, " << (after.liveBytes - before.liveBytes)
+            << " bytes live after delete\n";
+
+  // 2. a tournament attributes its allocations per scope; the summary prints both tables
+  std::cout << "\n2. Tournament allocation summary:\n";
+  GameEngine engine;
+  engine.transitionState(GameState::START);
+  engine.executeTournament("tournament -M Canada/Canada.map -P Aggressive, Benevolent -G 1 -D 10");
+
+  // 3. the same numbers through the stats api: cost of one turn of each phase
+  std::cout << "\n3. Per-run allocations by phase:\n";
+  for (const ProfileStat& stat : Profiler::getStats()) {
+    if (stat.category != ProfileCategory::PHASE) continue;
+    std::cout << stat.name << ": " << stat.allocations / stat.count << " allocations, "
+              << stat.allocatedBytes / stat.count << " bytes, peak " << stat.peakBytes << " bytes\n";
+  }
+
+  std::cout << "\n" << std::string(60, '=') << "\n";
+  std::cout << "END OF ALLOCATION TRACKING TEST\n";
+  std::cout << std::string(60, '=') << "\n";
+}
@@ -0,0 +1,254 @@
+#include "TournamentExport.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+
+/*
+ * Columnar row group layout (native byte order):
+ *   magic "RWZC", version, row count, column count
+ *   per column: length-prefixed name, type (0 = int64, 1 = float64, 2 = string), then one value per row
+ * Strings are length-prefixed. Player columns are p<i>_name, p<i>_territories and p<i>_armies.
+ */
+namespace {
+  constexpr char COLUMNAR_MAGIC[] = {'R', 'W', 'Z', 'C'};
+  constexpr std::int32_t COLUMNAR_VERSION = 1;
+
+  enum ColumnType : std::uint8_t { INT64 = 0, FLOAT64 = 1, STRING = 2 };
+
+  bool hasExtension(const std::string& path, const char* ext) {
+    return std::filesystem::path(path).extension() == ext;
+  }
+
+  template <typename T>
+  void putRaw(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void putString(std::string& out, const std::string& str) {
+    putRaw(out, static_cast<std::int32_t>(str.size()));
+    out.append(str);
+  }
+
+  std::string csvField(const std::string& field) {
+    if (field.find_first_of(",\"\n") == std::string::npos) return field;
+
+    std::string quoted = "\"";
+    for (char c : field) {
+      if (c == '"') quoted += '"';
+      quoted += c;
+    }
+    return quoted + "\"";
+  }
+
+  // the file had no content before we opened it, so it still needs a header
+  bool isNewFile(const std::string& path) {
+    std::error_code ec;
+    return !std::filesystem::exists(path, ec) || std::filesystem::file_size(path, ec) == 0;
+  }
+}
+
+
+// ==================== TournamentExporter Class Implementation ====================
+TournamentExporter::TournamentExporter(std::size_t groupSize) :
+  rowGroupSize(groupSize > 0 ? groupSize : 1) {}
+
+TournamentExporter::~TournamentExporter() {
+  flush();
+}
+
+// --- SINK MANAGEMENT ---
+bool TournamentExporter::addFile(const std::string& path) {
+  if (!isSupportedFile(path)) return false;
+
+  const bool fresh = isNewFile(path);
+  std::ofstream file(path, std::ios::binary | std::ios::app);
+  if (!file) return false;
+
+  paths.push_back(path);
+  if (hasExtension(path, EXPORT_FORMATS::CSV)) {
+    // the header depends on the player count, so it is written with the first record
+    csvFiles.push_back(std::move(file));
+    csvNeedsHeader.push_back(fresh);
+  } else if (hasExtension(path, EXPORT_FORMATS::JSONL)) {
+    jsonFiles.push_back(std::move(file));
+  } else {
+    columnarFiles.push_back(std::move(file));
+  }
+  return true;
+}
+
+bool TournamentExporter::empty() const {
+  return csvFiles.empty() && jsonFiles.empty() && columnarFiles.empty();
+}
+
+void TournamentExporter::setPlayerColumns(std::size_t count) {
+  playerColumns = count;
+}
+
+// --- EXPORT ---
+void TournamentExporter::write(const GameRecord& record) {
+  // without a width set up front, the first record decides it
+  if (playerColumns == 0) playerColumns = record.players.size();
+
+  // text formats stream one line per game
+  for (std::size_t i = 0; i < csvFiles.size(); ++i) {
+    if (csvNeedsHeader[i]) {
+      csvFiles[i] << csvHeader(playerColumns) << "\n";
+      csvNeedsHeader[i] = false;
+    }
+    csvFiles[i] << toCsv(record, playerColumns) << "\n" << std::flush;
+  }
+  for (auto& file : jsonFiles) {
+    file << toJson(record) << "\n" << std::flush;
+  }
+
+  // the columnar format batches records into row groups
+  if (columnarFiles.empty()) return;
+  pending.push_back(record);
+  if (pending.size() >= rowGroupSize) writeRowGroup();
+}
+
+void TournamentExporter::flush() {
+  if (!pending.empty()) writeRowGroup();
+}
+
+// --- CHECKPOINTING ---
+/**
+ * the size of every file with everything written so far on disk, pending row group included
+ * @return one size per file, in the order the files were added
+ */
+std::vector<std::uintmax_t> TournamentExporter::sizes() {
+  flush();
+  for (auto& file : csvFiles) file.flush();
+  for (auto& file : jsonFiles) file.flush();
+  for (auto& file : columnarFiles) file.flush();
+
+  std::vector<std::uintmax_t> fileSizes;
+  for (const std::string& path : paths) {
+    std::error_code ec;
+    const std::uintmax_t size = std::filesystem::file_size(path, ec);
+    fileSizes.push_back(ec ? 0 : size);
+  }
+  return fileSizes;
+}
+
+/**
+ * cut every file back to a size taken by sizes(); writes keep appending at the new end
+ * @return false (touching nothing) if the sizes were taken for a different set of files
+ */
+bool TournamentExporter::truncate(const std::vector<std::uintmax_t>& fileSizes) {
+  if (fileSizes.size() != paths.size()) return false;
+
+  pending.clear();
+  std::size_t csvIdx = 0;
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    std::error_code ec;
+    if (std::filesystem::file_size(paths[i], ec) > fileSizes[i] && !ec) {
+      std::filesystem::resize_file(paths[i], fileSizes[i], ec);
+    }
+    if (hasExtension(paths[i], EXPORT_FORMATS::CSV)) csvNeedsHeader[csvIdx++] = fileSizes[i] == 0;
+  }
+  return true;
+}
+
+// --- UTILITY ---
+bool TournamentExporter::isSupportedFile(const std::string& path) {
+  return hasExtension(path, EXPORT_FORMATS::CSV) || hasExtension(path, EXPORT_FORMATS::JSONL) ||
+         hasExtension(path, EXPORT_FORMATS::COLUMNAR);
+}
+
+// --- FORMATTING ---
+std::string TournamentExporter::csvHeader(std::size_t playerColumns) {
+  std::string header = "map,game,seed,winner,turns,wall_ms";
+  for (std::size_t i = 0; i < playerColumns; ++i) {
+    const std::string idx = std::to_string(i + 1);
+    header += ",player" + idx + ",territories" + idx + ",armies" + idx;
+  }
+  return header;
+}
+
+std::string TournamentExporter::toCsv(const GameRecord& record, std::size_t playerColumns) {
+  std::ostringstream row;
+  row << csvField(record.map) << "," << record.gameIndex << "," << record.seed << ","
+      << csvField(record.winner) << "," << record.turnsPlayed << "," << record.wallTimeMs;
+
+  for (const auto& [name, territories, armies] : record.players) {
+    row << "," << csvField(name) << "," << territories << "," << armies;
+  }
+  for (std::size_t i = record.players.size(); i < playerColumns; ++i) row << ",,,";
+  return row.str();
+}
+
+std::string TournamentExporter::toJson(const GameRecord& record) {
+  std::ostringstream json;
+  json << "{\"map\":" << Utility::jsonString(record.map)
+       << ",\"game\":" << record.gameIndex
+       << ",\"seed\":" << record.seed
+       << ",\"winner\":" << Utility::jsonString(record.winner)
+       << ",\"turns\":" << record.turnsPlayed
+       << ",\"wall_ms\":" << record.wallTimeMs
+       << ",\"players\":[";
+
+  for (std::size_t i = 0; i < record.players.size(); ++i) {
+    const PlayerResult& play = record.players[i];
+    if (i > 0) json << ",";
+    json << "{\"name\":" << Utility::jsonString(play.name)
+         << ",\"territories\":" << play.territories
+         << ",\"armies\":" << play.armies << "}";
+  }
+  json << "]}";
+  return json.str();
+}
+
+void TournamentExporter::writeRowGroup() {
+  std::size_t playerCount = playerColumns;
+  for (const GameRecord& rec : pending) playerCount = std::max(playerCount, rec.players.size());
+  const auto rows = static_cast<std::int32_t>(pending.size());
+
+  std::string out;
+  out.append(COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+  putRaw(out, COLUMNAR_VERSION);
+  putRaw(out, rows);
+  putRaw(out, static_cast<std::int32_t>(6 + 3 * playerCount));
+
+  auto intColumn = [&](const std::string& name, auto value) {
+    putString(out, name);
+    putRaw(out, INT64);
+    for (const GameRecord& rec : pending) putRaw(out, static_cast<std::int64_t>(value(rec)));
+  };
+  auto stringColumn = [&](const std::string& name, auto value) {
+    putString(out, name);
+    putRaw(out, STRING);
+    for (const GameRecord& rec : pending) putString(out, value(rec));
+  };
+
+  stringColumn("map", [](const GameRecord& rec) { return rec.map; });
+  intColumn("game", [](const GameRecord& rec) { return rec.gameIndex; });
+  intColumn("seed", [](const GameRecord& rec) { return rec.seed; });
+  stringColumn("winner", [](const GameRecord& rec) { return rec.winner; });
+  intColumn("turns", [](const GameRecord& rec) { return rec.turnsPlayed; });
+
+  putString(out, "wall_ms");
+  putRaw(out, FLOAT64);
+  for (const GameRecord& rec : pending) putRaw(out, rec.wallTimeMs);
+
+  // records with fewer players than the widest one (smaller lineups, failed games) export as empty/zero
+  for (std::size_t i = 0; i < playerCount; ++i) {
+    // built by appending: "p" + std::string temporary trips GCC's -Wrestrict false positive at -O2
+    std::string prefix("p");
+    prefix.append(std::to_string(i + 1)).append("_");
+    auto player = [i](const GameRecord& rec) { return i < rec.players.size() ? rec.players[i] : PlayerResult{}; };
+
+    stringColumn(prefix + "name", [&](const GameRecord& rec) { return player(rec).name; });
+    intColumn(prefix + "territories", [&](const GameRecord& rec) { return player(rec).territories; });
+    intColumn(prefix + "armies", [&](const GameRecord& rec) { return player(rec).armies; });
+  }
+
+  for (auto& file : columnarFiles) {
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    file.flush();
+  }
+  pending.clear();
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * Final standing of one player in a tournament game.
+ */
+struct PlayerResult {
+  std::string name;
+  int territories = 0;
+  int armies = 0;
+};
+
+/**
+ * One finished tournament game, as written by the TournamentExporter.
+ */
+struct GameRecord {
+  std::string map;
+  int gameIndex = 0;
+  std::uint32_t seed = 0;
+  std::string winner;
+  int turnsPlayed = 0;
+  double wallTimeMs = 0.0;
+  std::vector<PlayerResult> players; // one entry per tournament strategy, in command order
+};
+
+
+/**
+ * The TournamentExporter class streams GameRecords to machine-readable files as games finish.
+ * The format is picked from each file's extension:
+ *   .csv   one row per game, header written when the file is new, every row as wide as the header
+ *   .jsonl one json object per line
+ *   .col   append-only columnar row groups, each one self-describing (column names, types, values)
+ * All files are opened in append mode, so a resumed tournament keeps adding to the same files.
+ * A checkpointed tournament records sizes() with every finished game and calls truncate() on resume,
+ * so rows of a game that was exported but never checkpointed are dropped before the game is replayed.
+ */
+class TournamentExporter {
+private:
+  std::vector<std::ofstream> csvFiles;
+  std::vector<bool> csvNeedsHeader; // per csv file: it was empty when opened
+  std::vector<std::ofstream> jsonFiles;
+  std::vector<std::ofstream> columnarFiles;
+  std::vector<std::string> paths;  // every file, in the order it was added
+  std::vector<GameRecord> pending; // records waiting for the next columnar row group
+  std::size_t rowGroupSize;
+  std::size_t playerColumns = 0;   // player column sets per row, 0 until set or taken from the first record
+
+public:
+  explicit TournamentExporter(std::size_t groupSize = 32);
+  TournamentExporter(const TournamentExporter& other) = delete; // owns open files
+  TournamentExporter& operator=(const TournamentExporter& other) = delete;
+  ~TournamentExporter(); // destructor, flushes the last row group
+
+  // sink management
+  bool addFile(const std::string& path);
+  bool empty() const;
+  void setPlayerColumns(std::size_t count); // the largest lineup; shorter records are padded with empty columns
+
+  // export
+  void write(const GameRecord& record);
+  void flush();
+
+  // checkpointing
+  std::vector<std::uintmax_t> sizes();
+  bool truncate(const std::vector<std::uintmax_t>& fileSizes);
+
+  // utility
+  static bool isSupportedFile(const std::string& path);
+
+private:
+  // formatting
+  static std::string toCsv(const GameRecord& record, std::size_t playerColumns);
+  static std::string csvHeader(std::size_t playerColumns);
+  static std::string toJson(const GameRecord& record);
+  void writeRowGroup();
+};
+
+// namespaces
+namespace EXPORT_FORMATS {
+  constexpr auto CSV = ".csv";
+  constexpr auto JSONL = ".jsonl";
+  constexpr auto COLUMNAR = ".col";
+}
@@ -0,0 +1,149 @@
+#include "TournamentScheduler.h"
+#include "Map.h"
+#include "PlayerStrategies.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  // territories a strategy takes in a turn once it is fighting, roughly: the cheater takes every neighbour,
+  // the attackers push along one front, the others only hold what they have
+  double conquestRate(const std::string& strategy) {
+    if (strategy == PLAYER_STRATEGIES::CHEATER) return 6.0;
+    if (strategy == PLAYER_STRATEGIES::AGGRESSIVE || strategy == PLAYER_STRATEGIES::MCTS) return 1.5;
+    return 0.0;
+  }
+}
+
+// ==================== TournamentScheduler Class Implementation ====================
+TournamentScheduler::TournamentScheduler(const TournamentSpec& spec, int workers) :
+  stream(spec),
+  stats(std::max(1, workers)) {
+  for (int i = 0; i < std::max(1, workers); i++) queues.push_back(std::make_unique<Queue>());
+}
+
+// --- GETTERS ---
+const std::vector<WorkerStats>& TournamentScheduler::getStats() const {
+  return stats;
+}
+
+// --- MANAGEMENT ---
+std::optional<TournamentJob> TournamentScheduler::take(int worker) {
+  while (true) {
+    std::optional<ScheduledJob> next = popOwn(worker);
+    if (!next) {
+      next = steal(worker);
+      if (next) stats[worker].stolen++;
+    }
+    if (next) {
+      stats[worker].games++;
+      stats[worker].estimatedCost += next->cost;
+      return std::move(next->job);
+    }
+
+    // every queue looked empty: pull the next window, unless another worker already has
+    std::lock_guard<std::mutex> lock(refillMutex);
+    const bool refilled = std::ranges::any_of(queues, [](const std::unique_ptr<Queue>& queue) {
+      std::lock_guard<std::mutex> queueLock(queue->mutex);
+      return !queue->jobs.empty();
+    });
+    if (!refilled && !refill()) return std::nullopt;
+  }
+}
+
+void TournamentScheduler::finished(int worker, double busyMs) {
+  stats[worker].busyMs += busyMs;
+}
+
+// --- UTILITY ---
+/**
+ * estimate how long a game runs, in arbitrary units that only matter relative to each other
+ * @param job the game
+ * @param territories territory count of its map, 0 when it cannot be loaded
+ * @return the estimated cost
+ */
+double TournamentScheduler::estimateCost(const TournamentJob& job, int territories) {
+  if (territories <= 0) return 0.0; // the game fails at once
+
+  double rate = 0.0;
+  for (const std::string& strategy : job.lineup) rate = std::max(rate, conquestRate(strategy));
+
+  const double turns = rate > 0.0 ? std::min<double>(job.maxTurns, std::ceil(territories / rate)) : job.maxTurns;
+  return turns * territories * static_cast<double>(job.lineup.size());
+}
+
+// --- SCHEDULING ---
+std::optional<TournamentScheduler::ScheduledJob> TournamentScheduler::popOwn(int worker) {
+  Queue& queue = *queues[worker];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.jobs.empty()) return std::nullopt;
+
+  ScheduledJob job = std::move(queue.jobs.front());
+  queue.jobs.pop_front();
+  return job;
+}
+
+std::optional<TournamentScheduler::ScheduledJob> TournamentScheduler::steal(int worker) {
+  // the longest waiting job is at the front of some queue; it may be gone by the time that queue is locked
+  // again, in which case look once more
+  while (true) {
+    int victim = -1;
+    double longest = -1.0;
+    for (int i = 0; i < static_cast<int>(queues.size()); i++) {
+      if (i == worker) continue;
+      std::lock_guard<std::mutex> lock(queues[i]->mutex);
+      if (!queues[i]->jobs.empty() && queues[i]->jobs.front().cost > longest) {
+        victim = i;
+        longest = queues[i]->jobs.front().cost;
+      }
+    }
+    if (victim < 0) return std::nullopt;
+
+    Queue& queue = *queues[victim];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) continue;
+
+    ScheduledJob job = std::move(queue.jobs.front());
+    queue.jobs.pop_front();
+    return job;
+  }
+}
+
+bool TournamentScheduler::refill() {
+  std::vector<ScheduledJob> window;
+  while (window.size() < JOBS_PER_WORKER * queues.size()) {
+    std::optional<TournamentJob> job = stream.take();
+    if (!job) break;
+
+    const double cost = estimateCost(*job, territoryCount(job->map));
+    window.push_back({std::move(*job), cost});
+  }
+  if (window.empty()) return false;
+
+  // longest processing time first: each job joins the queue with the least estimated work so far
+  std::ranges::stable_sort(window, std::greater{}, &ScheduledJob::cost);
+  std::vector<double> load(queues.size(), 0.0);
+  for (ScheduledJob& job : window) {
+    const std::size_t target = std::ranges::min_element(load) - load.begin();
+    load[target] += job.cost;
+
+    std::lock_guard<std::mutex> lock(queues[target]->mutex);
+    queues[target]->jobs.push_back(std::move(job));
+  }
+  return true;
+}
+
+int TournamentScheduler::territoryCount(const std::string& map) {
+  if (const auto it = territories.find(map); it != territories.end()) return it->second;
+
+  // the same lookup as the game itself: the path as given, then under maps/
+  fs::path mapFile(map);
+  if (!fs::exists(mapFile)) mapFile = fs::current_path() / "maps" / map;
+
+  MapLoader loader;
+  const std::unique_ptr<Map> loaded = loader.loadMap(mapFile.string());
+  const int count = loaded ? static_cast<int>(loaded->getTerritories().size()) : 0;
+  territories.emplace(map, count);
+  return count;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "TournamentSpec.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The TournamentScheduler class deals the jobs of a sweep to a fixed set of workers.
+ * Jobs are pulled from the spec's stream a window at a time, never all at once. The spec numbers its jobs with the
+ * seed slowest, so a window cycles through the sweep's configurations rather than repeating one. Each window is sorted by
+ * estimated cost and dealt longest first onto per-worker queues, every job going to the queue with the least
+ * work so far. A worker plays its own queue from the front and, once it runs dry, steals the longest job
+ * waiting on any other queue, so long games start early and short ones fill the gaps at the end.
+ *
+ * A game costs about (territories x players) per turn, and lasts either until the fastest conqueror in the
+ * lineup has taken the map or until the turn limit. Benevolent and neutral players never take territory on
+ * their own, so a lineup of only those always plays to the limit.
+ */
+class TournamentScheduler {
+public:
+  static constexpr std::size_t JOBS_PER_WORKER = 16; // size of a window, per worker
+
+private:
+  struct ScheduledJob {
+    TournamentJob job;
+    double cost;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<ScheduledJob> jobs; // longest first
+  };
+
+  TournamentJobStream stream;
+  std::vector<std::unique_ptr<Queue>> queues;       // one per worker
+  std::vector<WorkerStats> stats;                   // one per worker, only written by its worker
+  std::mutex refillMutex;                           // one worker pulls the next window at a time
+  std::unordered_map<std::string, int> territories; // by map path, guarded by refillMutex
+
+public:
+  TournamentScheduler(const TournamentSpec& spec, int workers);
+  TournamentScheduler(const TournamentScheduler& other) = delete;
+  TournamentScheduler& operator=(const TournamentScheduler& other) = delete;
+
+  // getters
+  const std::vector<WorkerStats>& getStats() const; // read once every worker is done
+
+  // management
+  std::optional<TournamentJob> take(int worker);  // empty once the sweep has no jobs left
+  void finished(int worker, double busyMs);       // the last job taken by worker took busyMs
+
+  // utility
+  static double estimateCost(const TournamentJob& job, int territories);
+
+private:
+  // scheduling
+  std::optional<ScheduledJob> popOwn(int worker);
+  std::optional<ScheduledJob> steal(int worker);
+  bool refill(); // false when the stream is exhausted
+  int territoryCount(const std::string& map);
+};
+
+// free function
+void testTournamentScheduler();
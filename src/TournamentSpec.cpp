@@ -0,0 +1,454 @@
+#include "TournamentSpec.h"
+#include "GameEngine.h"
+#include "PlayerStrategies.h"
+#include "TournamentScheduler.h"
+#include "TournamentExport.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+// ==================== ValueRanges Class Implementation ====================
+// --- GETTERS ---
+std::uint64_t ValueRanges::size() const {
+  return total;
+}
+
+std::int64_t ValueRanges::at(std::uint64_t index) const {
+  for (const Range& range : ranges) {
+    if (index < range.count) return range.first + static_cast<std::int64_t>(index) * range.step;
+    index -= range.count;
+  }
+  return 0;
+}
+
+std::int64_t ValueRanges::min() const {
+  std::int64_t lowest = ranges.empty() ? 0 : ranges.front().first;
+  for (const Range& range : ranges) lowest = std::min(lowest, range.first);
+  return lowest;
+}
+
+std::int64_t ValueRanges::max() const {
+  std::int64_t highest = ranges.empty() ? 0 : ranges.front().first;
+  for (const Range& range : ranges) {
+    highest = std::max(highest, range.first + static_cast<std::int64_t>(range.count - 1) * range.step);
+  }
+  return highest;
+}
+
+// --- MANAGEMENT ---
+void ValueRanges::add(std::int64_t first, std::int64_t last, std::int64_t step) {
+  if (step <= 0 || last < first) return;
+
+  const std::uint64_t count = static_cast<std::uint64_t>((last - first) / step) + 1;
+  ranges.push_back({first, step, count});
+  total += count;
+}
+
+// --- UTILITY ---
+std::optional<ValueRanges> ValueRanges::parse(const std::string& text) {
+  ValueRanges values;
+  std::istringstream items(text);
+
+  for (std::string item; std::getline(items, item, ',');) {
+    item.erase(std::remove_if(item.begin(), item.end(), ::isspace), item.end());
+    if (item.empty()) continue;
+
+    // "first", "first-last" or "first-last/step"
+    try {
+      std::size_t used = 0;
+      const std::int64_t first = std::stoll(item, &used);
+      std::int64_t last = first, step = 1;
+
+      if (used < item.size() && item[used] == '-') {
+        std::size_t more = 0;
+        const std::string rest = item.substr(used + 1);
+        last = std::stoll(rest, &more);
+        if (more < rest.size() && rest[more] == '/') {
+          const std::string stepText = rest.substr(more + 1);
+          step = std::stoll(stepText, &more);
+          if (more != stepText.size()) return std::nullopt;
+        } else if (more != rest.size()) {
+          return std::nullopt;
+        }
+      } else if (used != item.size()) {
+        return std::nullopt;
+      }
+
+      if (last < first || step <= 0) return std::nullopt;
+      values.add(first, last, step);
+    } catch (const std::exception&) {
+      return std::nullopt;
+    }
+  }
+
+  if (values.size() == 0) return std::nullopt;
+  return values;
+}
+
+
+// ==================== TournamentSpec Class Implementation ====================
+namespace {
+  std::string trimmed(const std::string& text) {
+    const std::size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    return text.substr(begin, text.find_last_not_of(" \t\r") - begin + 1);
+  }
+
+  std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    std::istringstream stream(text);
+    for (std::string item; std::getline(stream, item, ',');) {
+      item = trimmed(item);
+      if (!item.empty()) items.push_back(item);
+    }
+    return items;
+  }
+
+  std::string lowered(std::string text) {
+    std::ranges::transform(text, text.begin(), ::tolower);
+    return text;
+  }
+
+  // only strategies that never wait on a person can be swept
+  bool isSweepStrategy(const std::string& key) {
+    return key == PLAYER_STRATEGIES::AGGRESSIVE || key == PLAYER_STRATEGIES::BENEVOLENT ||
+           key == PLAYER_STRATEGIES::NEUTRAL || key == PLAYER_STRATEGIES::CHEATER || key == PLAYER_STRATEGIES::MCTS;
+  }
+
+  // a map entry is looked up next to the spec, then from the working folder, then under maps/
+  std::vector<std::string> resolveMaps(const std::string& entry, const fs::path& baseDir) {
+    std::error_code ec;
+    for (const fs::path& candidate : {baseDir / entry, fs::path(entry), fs::current_path() / "maps" / entry}) {
+      if (fs::is_directory(candidate, ec)) return Utility::findMapFiles(candidate.string());
+      if (fs::is_regular_file(candidate, ec)) return {fs::relative(candidate, ec).lexically_normal().string()};
+    }
+    return {};
+  }
+
+  // every way of picking size strategies out of the list, keeping list order
+  void addCombinations(
+    const std::vector<std::string>& strategies, std::size_t size, std::vector<std::vector<std::string>>& lineups
+  ) {
+    if (size == 0 || size > strategies.size()) return;
+
+    std::vector<std::size_t> picks(size);
+    for (std::size_t i = 0; i < size; i++) picks[i] = i;
+
+    while (true) {
+      std::vector<std::string>& lineup = lineups.emplace_back();
+      for (const std::size_t pick : picks) lineup.push_back(strategies[pick]);
+
+      // advance the rightmost pick that still has room
+      std::size_t i = size;
+      while (i > 0 && picks[i - 1] == strategies.size() - size + i - 1) i--;
+      if (i == 0) return;
+
+      picks[i - 1]++;
+      for (std::size_t j = i; j < size; j++) picks[j] = picks[j - 1] + 1;
+    }
+  }
+}
+
+// --- GETTERS ---
+const std::vector<std::string>& TournamentSpec::getMaps() const {
+  return maps;
+}
+
+const std::vector<std::vector<std::string>>& TournamentSpec::getLineups() const {
+  return lineups;
+}
+
+const ValueRanges& TournamentSpec::getTurns() const {
+  return turns;
+}
+
+const ValueRanges& TournamentSpec::getSeeds() const {
+  return seeds;
+}
+
+const std::vector<std::string>& TournamentSpec::getOutputs() const {
+  return outputs;
+}
+
+int TournamentSpec::getWorkers() const {
+  return workers;
+}
+
+// --- JOBS ---
+std::uint64_t TournamentSpec::jobCount() const {
+  return maps.size() * lineups.size() * turns.size() * seeds.size();
+}
+
+TournamentJob TournamentSpec::job(std::uint64_t index) const {
+  TournamentJob job;
+  job.index = index;
+
+  // mixed-radix decode: lineup varying fastest, then turn limit and map, seed slowest
+  job.lineup = lineups[index % lineups.size()];
+  index /= lineups.size();
+  job.maxTurns = static_cast<int>(turns.at(index % turns.size()));
+  index /= turns.size();
+  job.map = maps[index % maps.size()];
+  index /= maps.size();
+  job.seed = static_cast<std::uint32_t>(seeds.at(index));
+  return job;
+}
+
+// --- LOADING ---
+std::optional<TournamentSpec> TournamentSpec::load(const std::string& path, std::string& error) {
+  std::ifstream in(path);
+  if (!in) {
+    error = "cannot open " + path;
+    return std::nullopt;
+  }
+  return parse(in, fs::path(path).parent_path().string(), error);
+}
+
+std::optional<TournamentSpec> TournamentSpec::parse(std::istream& in, const std::string& baseDir, std::string& error) {
+  error.clear();
+  TournamentSpec spec;
+  std::vector<std::string> strategies;
+  std::optional<ValueRanges> sizes, seeds, turns;
+  int games = 0;
+
+  int lineNo = 0;
+  for (std::string line; std::getline(in, line);) {
+    lineNo++;
+    line = trimmed(line.substr(0, line.find('#')));
+    if (line.empty()) continue;
+
+    const std::size_t eq = line.find('=');
+    const std::string where = "line " + std::to_string(lineNo) + ": ";
+    if (eq == std::string::npos) {
+      error = where + "expected 'key = value'";
+      return std::nullopt;
+    }
+    const std::string key = lowered(trimmed(line.substr(0, eq)));
+    const std::string value = trimmed(line.substr(eq + 1));
+
+    if (key == "maps") {
+      for (const std::string& entry : splitList(value)) {
+        const std::vector<std::string> found = resolveMaps(entry, baseDir);
+        if (found.empty()) {
+          error = where + "no map files found for " + entry;
+          return std::nullopt;
+        }
+        spec.maps.insert(spec.maps.end(), found.begin(), found.end());
+      }
+    } else if (key == "strategies" || key == "lineup") {
+      std::vector<std::string> names;
+      for (const std::string& name : splitList(value)) {
+        if (!isSweepStrategy(lowered(name))) {
+          error = where + "unknown or interactive strategy " + name;
+          return std::nullopt;
+        }
+        names.push_back(lowered(name));
+      }
+
+      if (key == "strategies") {
+        strategies.insert(strategies.end(), names.begin(), names.end());
+      } else if (names.size() < 2) {
+        error = where + "a lineup needs at least 2 strategies";
+        return std::nullopt;
+      } else {
+        spec.lineups.push_back(std::move(names));
+      }
+    } else if (key == "players" || key == "turns" || key == "seeds") {
+      std::optional<ValueRanges> values = ValueRanges::parse(value);
+      if (!values) {
+        error = where + "expected numbers or ranges such as 1-100 or 10-50/10";
+        return std::nullopt;
+      }
+      (key == "players" ? sizes : key == "turns" ? turns : seeds) = std::move(values);
+    } else if (key == "games" || key == "workers") {
+      int number = -1;
+      try {
+        number = std::stoi(value);
+      } catch (const std::exception&) {}
+
+      if (number < (key == "games" ? 1 : 0)) {
+        error = where + key + " must be a " + (key == "games" ? "positive" : "non-negative") + " number";
+        return std::nullopt;
+      }
+      (key == "games" ? games : spec.workers) = number;
+    } else if (key == "output") {
+      for (const std::string& file : splitList(value)) {
+        if (!TournamentExporter::isSupportedFile(file)) {
+          error = where + "unsupported export file " + file + ", use .csv, .jsonl or .col";
+          return std::nullopt;
+        }
+        spec.outputs.push_back(file);
+      }
+    } else {
+      error = where + "unknown key '" + key + "'";
+      return std::nullopt;
+    }
+  }
+
+  // generated lineups come before the explicit ones
+  std::vector<std::vector<std::string>> explicitLineups = std::move(spec.lineups);
+  spec.lineups.clear();
+  if (sizes) {
+    if (sizes->min() < 2) {
+      error = "players must be at least 2";
+      return std::nullopt;
+    }
+    for (std::uint64_t i = 0; i < sizes->size(); i++) {
+      addCombinations(strategies, static_cast<std::size_t>(sizes->at(i)), spec.lineups);
+    }
+  } else if (explicitLineups.empty() && strategies.size() >= 2) {
+    spec.lineups.push_back(strategies);
+  }
+  spec.lineups.insert(spec.lineups.end(), explicitLineups.begin(), explicitLineups.end());
+
+  if (!seeds) {
+    seeds.emplace();
+    seeds->add(1, games > 0 ? games : 1);
+  }
+
+  if (spec.maps.empty()) error = "no maps given";
+  else if (spec.lineups.empty()) error = "no lineups: give at least 2 strategies, players sizes they allow, or lineup lines";
+  else if (!turns) error = "no turn limits given";
+  else if (turns->min() < 1) error = "turn limits must be at least 1";
+  else if (seeds->min() < 0 || seeds->max() > UINT32_MAX) error = "seeds must fit in 32 bits";
+  if (!error.empty()) return std::nullopt;
+
+  spec.turns = std::move(*turns);
+  spec.seeds = std::move(*seeds);
+  return spec;
+}
+
+
+// ==================== TournamentJobStream Class Implementation ====================
+TournamentJobStream::TournamentJobStream(const TournamentSpec& spec) :
+  spec(spec) {}
+
+// --- MANAGEMENT ---
+std::optional<TournamentJob> TournamentJobStream::take() {
+  const std::uint64_t index = next.fetch_add(1, std::memory_order_relaxed);
+  if (index >= spec.jobCount()) return std::nullopt;
+  return spec.job(index);
+}
+
+
+// ==================== TournamentSweep Class Implementation ====================
+// --- MANAGEMENT ---
+SweepSummary TournamentSweep::run(const TournamentSpec& spec, int workers) {
+  const auto start = std::chrono::steady_clock::now();
+  if (workers <= 0) workers = spec.getWorkers();
+  if (workers <= 0) workers = Parallelism::available();
+  workers = static_cast<int>(std::min<std::uint64_t>(workers, std::max<std::uint64_t>(1, spec.jobCount())));
+
+  // csv rows are as wide as the largest lineup, whichever game happens to finish first
+  TournamentExporter exporter;
+  std::size_t largestLineup = 0;
+  for (const auto& lineup : spec.getLineups()) largestLineup = std::max(largestLineup, lineup.size());
+  exporter.setPlayerColumns(largestLineup);
+  for (const std::string& file : spec.getOutputs()) {
+    if (!exporter.addFile(file)) std::cerr << "Warning: cannot export results to " << file << "\n";
+  }
+
+  SweepSummary summary;
+  std::mutex resultsMutex; // guards the summary and the exporter
+  TournamentScheduler scheduler(spec, workers);
+
+  // every worker keeps one engine; each game replaces its map and players
+  auto work = [&](int worker) {
+    const Parallelism::PoolScope pooled;
+    const Console::MuteScope quiet;
+    const AllocationCounters heapStart = AllocationTracker::current();
+    const std::int64_t savedPeak = AllocationTracker::beginPeak();
+    GameEngine engine;
+    while (const std::optional<TournamentJob> job = scheduler.take(worker)) {
+      const auto gameStart = std::chrono::steady_clock::now();
+      const std::string winner = engine.playTournamentGame(job->map, job->lineup, job->maxTurns, job->seed);
+
+      GameRecord record;
+      record.map = job->map;
+      record.gameIndex = static_cast<int>(job->index + 1);
+      record.seed = job->seed;
+      record.winner = winner;
+      record.turnsPlayed = engine.getTurnsPlayed();
+      record.wallTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - gameStart).count();
+      if (winner != "Error") record.players = engine.tournamentStandings(job->lineup);
+
+      std::lock_guard<std::mutex> lock(resultsMutex);
+      summary.games++;
+      if (winner == "Error") summary.errors++;
+      else if (winner == "Draw") summary.draws++;
+      else summary.wins[winner]++;
+      if (winner != "Error") summary.turnsPlayed += record.turnsPlayed;
+      if (!exporter.empty()) exporter.write(record);
+      scheduler.finished(worker, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - gameStart).count());
+    }
+
+    // profiler stats and heap counters are per thread: hand this worker's over before the thread ends
+    const AllocationCounters heap = AllocationTracker::current();
+    const std::int64_t peak = AllocationTracker::endPeak(savedPeak) - heapStart.liveBytes;
+    std::lock_guard<std::mutex> lock(resultsMutex);
+    Profiler::merge(summary.profile, Profiler::getStats());
+    summary.heap.allocations += heap.allocations - heapStart.allocations;
+    summary.heap.bytes += heap.bytes - heapStart.bytes;
+    summary.heap.peakBytes = std::max(summary.heap.peakBytes, peak);
+  };
+
+  const Console::FilterScope filtered;
+  std::vector<std::thread> pool;
+  for (int t = 0; t < workers; t++) pool.emplace_back(work, t);
+  for (auto& worker : pool) worker.join();
+  exporter.flush();
+
+  summary.wallTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  summary.workers = scheduler.getStats();
+  return summary;
+}
+
+// --- UTILITY ---
+void TournamentSweep::report(const TournamentSpec& spec, const SweepSummary& summary, std::ostream& os) {
+  os << "Sweep: " << spec.getMaps().size() << " maps x " << spec.getLineups().size() << " lineups x "
+     << spec.getTurns().size() << " turn limits x " << spec.getSeeds().size() << " seeds = " << spec.jobCount()
+     << " games\n";
+  os << "Played " << summary.games << " games in " << std::fixed << std::setprecision(1) << summary.wallTimeMs
+     << " ms: " << summary.draws << " draws, " << summary.errors << " errors";
+  if (summary.games > summary.errors) {
+    os << ", " << static_cast<double>(summary.turnsPlayed) / static_cast<double>(summary.games - summary.errors)
+       << " turns per game";
+  }
+  os << "\n";
+
+  // most wins first
+  std::vector<std::pair<std::string, std::uint64_t>> ranking(summary.wins.begin(), summary.wins.end());
+  std::ranges::stable_sort(ranking, std::greater{}, &std::pair<std::string, std::uint64_t>::second);
+  for (const auto& [name, wins] : ranking) {
+    os << "  " << std::left << std::setw(12) << name << std::right << wins << " wins\n";
+  }
+
+  // utilisation is the share of the sweep's wall time a worker spent playing
+  if (summary.workers.empty()) return;
+  double busy = 0.0;
+  os << "Workers:\n";
+  for (std::size_t i = 0; i < summary.workers.size(); i++) {
+    const WorkerStats& worker = summary.workers[i];
+    const double utilisation = summary.wallTimeMs > 0.0 ? 100.0 * worker.busyMs / summary.wallTimeMs : 0.0;
+    busy += worker.busyMs;
+    os << "  worker " << std::setw(2) << i << ": " << std::setw(6) << worker.games << " games ("
+       << worker.stolen << " stolen), " << std::setprecision(0) << worker.estimatedCost << " estimated cost, "
+       << std::setprecision(1) << worker.busyMs << " ms busy, " << utilisation << "% utilised\n";
+  }
+  const double capacity = summary.wallTimeMs * static_cast<double>(summary.workers.size());
+  os << "  overall: " << (capacity > 0.0 ? 100.0 * busy / capacity : 0.0) << "% utilised\n";
+
+  // timing and allocation summary over every worker, for whichever instrumentation is compiled in
+  if (Profiler::isEnabled()) { Profiler::report(os, summary.profile); }
+  if (AllocationTracker::isEnabled()) {
+    os << "\nSweep heap: " << summary.heap.allocations << " allocations, " << summary.heap.bytes / 1024
+       << " KiB allocated, " << summary.heap.peakBytes / 1024 << " KiB peak (largest worker)\n";
+  }
+}
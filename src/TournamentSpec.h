@@ -0,0 +1,154 @@
+#pragma once
+#include "Profiler.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * One game of a tournament sweep.
+ */
+struct TournamentJob {
+  std::uint64_t index = 0;         // position in the sweep
+  std::string map;
+  std::vector<std::string> lineup; // strategy keys, in seating order
+  int maxTurns = 0;
+  std::uint32_t seed = 0;
+};
+
+
+/**
+ * Integers written as comma-separated values and inclusive ranges, e.g. "7", "1-1000" or "10-50/10".
+ * Values are produced by position, so a range of any length costs the same to hold.
+ */
+class ValueRanges {
+private:
+  struct Range {
+    std::int64_t first;
+    std::int64_t step;
+    std::uint64_t count;
+  };
+
+  std::vector<Range> ranges;
+  std::uint64_t total = 0;
+
+public:
+  // getters
+  std::uint64_t size() const;
+  std::int64_t at(std::uint64_t index) const; // index must be in [0, size())
+  std::int64_t min() const;
+  std::int64_t max() const;
+
+  // management
+  void add(std::int64_t first, std::int64_t last, std::int64_t step = 1);
+
+  // utility
+  static std::optional<ValueRanges> parse(const std::string& text);
+};
+
+
+/**
+ * The TournamentSpec class describes a tournament sweep read from a spec file, one "key = value" per line:
+ *   maps       = Canada/Canada.map, maps/Europe   map files, or folders searched for every .map below them
+ *   strategies = aggressive, benevolent, cheater  strategies the generated lineups are drawn from
+ *   players    = 2-3                              lineup sizes; every combination of that many strategies
+ *   lineup     = aggressive, aggressive           an explicit lineup, may be repeated
+ *   turns      = 10-50/20                         turn limits to sweep over
+ *   seeds      = 1-1000                           one game per seed (or games = N for seeds 1 to N)
+ *   output     = sweep.csv, sweep.jsonl           export files, as with -O
+ *   workers    = 8                                threads to play on, 0 for every hardware thread
+ * '#' starts a comment. Without players or lineup lines, all the strategies form a single lineup.
+ * Jobs are the cartesian product maps x lineups x turns x seeds, and any job is decoded from its number alone, so
+ * a sweep is never expanded in memory. They are numbered with the lineup varying fastest and the seed slowest, so
+ * any run of consecutive jobs mixes strategies, turn limits and maps rather than repeating one configuration.
+ */
+class TournamentSpec {
+private:
+  std::vector<std::string> maps;
+  std::vector<std::vector<std::string>> lineups;
+  ValueRanges turns;
+  ValueRanges seeds;
+  std::vector<std::string> outputs;
+  int workers = 0;
+
+public:
+  // getters
+  const std::vector<std::string>& getMaps() const;
+  const std::vector<std::vector<std::string>>& getLineups() const;
+  const ValueRanges& getTurns() const;
+  const ValueRanges& getSeeds() const;
+  const std::vector<std::string>& getOutputs() const;
+  int getWorkers() const;
+
+  // jobs
+  std::uint64_t jobCount() const;
+  TournamentJob job(std::uint64_t index) const; // index must be in [0, jobCount())
+
+  // loading
+  static std::optional<TournamentSpec> load(const std::string& path, std::string& error);
+  static std::optional<TournamentSpec> parse(std::istream& in, const std::string& baseDir, std::string& error);
+};
+
+
+/**
+ * Hands out the jobs of a spec in order to any number of threads, decoding each one only when it is taken.
+ */
+class TournamentJobStream {
+private:
+  const TournamentSpec& spec;
+  std::atomic<std::uint64_t> next = 0;
+
+public:
+  explicit TournamentJobStream(const TournamentSpec& spec);
+
+  // management
+  std::optional<TournamentJob> take(); // empty once every job has been handed out
+};
+
+
+/**
+ * What one worker of a sweep did.
+ */
+struct WorkerStats {
+  std::uint64_t games = 0;
+  std::uint64_t stolen = 0;   // games taken from another worker's queue
+  double estimatedCost = 0.0; // sum of the cost estimates of its games
+  double busyMs = 0.0;        // time spent playing, the rest was spent waiting for work
+};
+
+
+/**
+ * Totals of a sweep. Single games are only streamed to the export files, never kept.
+ */
+struct SweepSummary {
+  std::uint64_t games = 0;
+  std::uint64_t draws = 0;
+  std::uint64_t errors = 0;                   // maps that failed to load or validate
+  std::map<std::string, std::uint64_t> wins; // by winner name
+  std::uint64_t turnsPlayed = 0;
+  double wallTimeMs = 0.0;
+  std::vector<WorkerStats> workers;
+  std::vector<ProfileStat> profile; // every worker's Profiler stats, merged
+  AllocationCounters heap;          // every worker's heap activity; peakBytes is the largest worker's peak
+};
+
+
+/**
+ * The TournamentSweep class plays every job of a spec across a pool of threads, each with its own engine,
+ * handing the jobs out through a TournamentScheduler. Engine output on the sweep's threads is muted.
+ */
+class TournamentSweep {
+public:
+  // management
+  static SweepSummary run(const TournamentSpec& spec, int workers = 0); // 0 uses the spec's worker count
+
+  // utility
+  static void report(const TournamentSpec& spec, const SweepSummary& summary, std::ostream& os);
+};
+
+// free function
+void testTournamentSpec();
@@ -0,0 +1,131 @@
+#include "Tracer.h"
+#include "Utility.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace {
+  struct TraceEvent {
+    char phase;           // 'X' complete, 'i' instant
+    const char* category;
+    std::string name;
+    std::int64_t beginNs; // relative to the start of the trace
+    std::int64_t durNs;
+    int tid;
+    std::string detail;
+  };
+
+  std::mutex traceMutex;
+  std::atomic<bool> active = false;
+  std::vector<TraceEvent> events;
+  std::string tracePath;
+  Tracer::Clock::time_point origin;
+
+  // small, stable thread ids read better in the viewer than hashed std::thread::ids
+  int threadId() {
+    static std::atomic<int> nextId = 1;
+    thread_local const int id = nextId++;
+    return id;
+  }
+
+  // scopes opened before the trace started are clamped to its start
+  std::int64_t sinceOrigin(Tracer::Clock::time_point time) {
+    return std::max<std::int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(time - origin).count());
+  }
+
+  // chrome traces are in microseconds; keep the nanoseconds as decimals
+  std::string micros(std::int64_t ns) {
+    return std::to_string(ns / 1000) + "." + std::to_string(1000 + ns % 1000).substr(1);
+  }
+}
+
+
+// ==================== Tracer Class Implementation ====================
+// --- RECORDING ---
+bool Tracer::start(const std::string& path) {
+  // fail early rather than after a long tournament
+  if (!std::ofstream(path, std::ios::out | std::ios::trunc)) return false;
+
+  const std::lock_guard lock(traceMutex);
+  events.clear();
+  tracePath = path;
+  origin = Clock::now();
+  active = true;
+  return true;
+}
+
+bool Tracer::stop() {
+  const std::lock_guard lock(traceMutex);
+  if (!active) return false;
+  active = false;
+
+  std::ofstream file(tracePath, std::ios::out | std::ios::trunc);
+  if (!file) return false;
+
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    const TraceEvent& event = events[i];
+    file << (i > 0 ? ",\n" : "\n")
+         << "{\"name\":" << Utility::jsonString(event.name)
+         << ",\"cat\":\"" << event.category << "\""
+         << ",\"ph\":\"" << event.phase << "\""
+         << ",\"ts\":" << micros(event.beginNs);
+
+    if (event.phase == 'X') file << ",\"dur\":" << micros(event.durNs);
+    else file << ",\"s\":\"t\"";
+
+    file << ",\"pid\":1,\"tid\":" << event.tid;
+    if (!event.detail.empty()) file << ",\"args\":{\"detail\":" << Utility::jsonString(event.detail) << "}";
+    file << "}";
+  }
+  file << "\n]}\n";
+
+  events.clear();
+  return static_cast<bool>(file);
+}
+
+bool Tracer::isActive() {
+  return active.load(std::memory_order_relaxed);
+}
+
+// --- EVENTS ---
+void Tracer::complete(const char* category, std::string_view name, Clock::time_point begin, Clock::time_point end) {
+  const int tid = threadId();
+  const std::lock_guard lock(traceMutex);
+  if (!active) return;
+
+  const std::int64_t beginNs = sinceOrigin(begin);
+  events.push_back({'X', category, std::string(name), beginNs, sinceOrigin(end) - beginNs, tid, ""});
+}
+
+void Tracer::instant(const char* category, std::string_view name, const std::string& detail) {
+  const int tid = threadId();
+  const auto now = Clock::now();
+  const std::lock_guard lock(traceMutex);
+  if (!active) return;
+
+  events.push_back({'i', category, std::string(name), sinceOrigin(now), 0, tid, detail});
+}
+
+std::size_t Tracer::eventCount() {
+  const std::lock_guard lock(traceMutex);
+  return events.size();
+}
+
+
+// ==================== TraceObserver Class Implementation ====================
+// --- MANAGEMENT ---
+void TraceObserver::update(Subject* sub) {
+  if (!sub || !Tracer::isActive()) return;
+
+  const ILoggable* loggable = dynamic_cast<ILoggable*>(sub);
+  if (!loggable) return;
+
+  // log lines read "<what happened>: <details>"; the part before the colon names the event
+  const std::string line = loggable->stringToLog();
+  const std::size_t colon = line.find(':');
+  Tracer::instant("notify", colon == std::string::npos ? line : line.substr(0, colon), line);
+}
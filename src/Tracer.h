@@ -0,0 +1,39 @@
+#pragma once
+#include "LoggingObserver.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * The Tracer class records begin/end events of game execution and writes them as a Chrome trace
+ * (json "traceEvents" format), which chrome://tracing and ui.perfetto.dev open directly.
+ * Every PROFILE_SCOPE (games, turns, phases, order execution, strategy issueOrder) becomes a complete event
+ * while a trace is being recorded, so tracing needs the profiling timers compiled in (RISK_PROFILING).
+ * Subject notifications (state changes, issued orders, order effects) become instant events through a TraceObserver.
+ */
+class Tracer {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  // recording
+  static bool start(const std::string& path); // clears earlier events; false if the file cannot be written
+  static bool stop();                         // writes the trace file; false if nothing was being recorded
+  static bool isActive();
+
+  // events
+  static void complete(const char* category, std::string_view name, Clock::time_point begin, Clock::time_point end);
+  static void instant(const char* category, std::string_view name, const std::string& detail);
+  static std::size_t eventCount();
+};
+
+
+/**
+ * Forwards every notification of the subjects it is attached to into the current trace as an instant event.
+ */
+class TraceObserver : public Observer {
+public:
+  // management
+  void update(Subject* sub) override;
+};
@@ -1,7 +1,122 @@
 #include "Utility.h"
 #include <algorithm>
+#include <cstdio>
 #include <iostream>
+#include <mutex>
+#include <optional>
+#include <streambuf>
+#include <thread>
+#include <utility>
 
+namespace {
+  // sits in front of the console's own buffer while muted pools run; unbuffered, so every write is checked
+  // against the thread making it
+  class ThreadFilterBuffer : public std::streambuf {
+  private:
+    std::streambuf* console;
+
+  public:
+    explicit ThreadFilterBuffer(std::streambuf* console) : console(console) {}
+
+    std::streambuf* getConsole() const { return console; }
+
+  protected:
+    int overflow(int c) override {
+      if (Console::isMuted() || traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+      return console->sputc(traits_type::to_char_type(c));
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+      return Console::isMuted() ? n : console->sputn(s, n);
+    }
+
+    int sync() override {
+      return console->pubsync();
+    }
+  };
+
+  // shared by every FilterScope: the first one installs the filter, the last one takes it out again
+  struct ConsoleRouting {
+    std::mutex mutex;
+    int scopes = 0;
+    std::optional<ThreadFilterBuffer> filter;
+  };
+
+  ConsoleRouting& consoleRouting() {
+    static ConsoleRouting routing;
+    return routing;
+  }
+}
+
+// ==================== Console Class Implementation ====================
+thread_local bool Console::muted = false;
+
+Console::FilterScope::FilterScope() {
+  ConsoleRouting& routing = consoleRouting();
+  std::lock_guard<std::mutex> lock(routing.mutex);
+  if (routing.scopes++ > 0) return;
+
+  routing.filter.emplace(std::cout.rdbuf());
+  std::cout.rdbuf(&*routing.filter);
+}
+
+Console::FilterScope::~FilterScope() {
+  ConsoleRouting& routing = consoleRouting();
+  std::lock_guard<std::mutex> lock(routing.mutex);
+  if (--routing.scopes > 0) return;
+
+  std::cout.flush();
+  std::cout.rdbuf(routing.filter->getConsole());
+  routing.filter.reset();
+}
+
+Console::MuteScope::MuteScope() :
+  previous(std::exchange(muted, true)) {}
+
+Console::MuteScope::~MuteScope() {
+  muted = previous;
+}
+
+bool Console::isMuted() {
+  return muted;
+}
+
+
+// ==================== GameRandom Class Implementation ====================
+thread_local GameRandom::Engine* GameRandom::bound = nullptr;
+
+GameRandom::Scope::Scope(Engine& rng) :
+  previous(std::exchange(bound, &rng)) {}
+
+GameRandom::Scope::~Scope() {
+  bound = previous;
+}
+
+GameRandom::Engine& GameRandom::get() {
+  if (bound) return *bound;
+
+  static thread_local Engine fallback(std::random_device{}());
+  return fallback;
+}
+
+
+// ==================== Parallelism Class Implementation ====================
+thread_local bool Parallelism::inPool = false;
+
+Parallelism::PoolScope::PoolScope() :
+  previous(std::exchange(inPool, true)) {}
+
+Parallelism::PoolScope::~PoolScope() {
+  inPool = previous;
+}
+
+int Parallelism::available() {
+  if (inPool) return 1;
+  return static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+
+// ==================== Utility Class Implementation ====================
 /**
  * Recursively find all .map files in a directory and its subdirectories
  */
@@ -27,3 +142,25 @@ std::vector<std::string> Utility::findMapFiles(const std::string& dir) {
   std::ranges::sort(dotMapFiles);
   return dotMapFiles;
 }
+
+/**
+ * Quote and escape a string as a json string literal
+ */
+std::string Utility::jsonString(const std::string& str) {
+  std::string escaped = "\"";
+  for (char c : str) {
+    switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+          escaped += buf;
+        } else escaped += c;
+    }
+  }
+  return escaped + "\"";
+}
@@ -1,11 +1,96 @@
 #pragma once
 #include <filesystem>
+#include <random>
 #include <string>
 #include <vector>
 
 namespace fs = std::filesystem;
 
+/**
+ * Per-thread muting of std::cout, used to keep background work off the console. While a FilterScope is alive,
+ * std::cout is routed through a buffer that drops what muted threads write and passes everything else on, so a
+ * pool can run engine code quietly while the rest of the process keeps its console. Pool runners open a
+ * FilterScope before starting their threads and close it once they are joined; the last one restores std::cout.
+ */
+class Console {
+public:
+  class FilterScope {
+  public:
+    FilterScope();
+    FilterScope(const FilterScope& other) = delete;
+    FilterScope& operator=(const FilterScope& other) = delete;
+    ~FilterScope(); // destructor, restores std::cout once no other scope is alive
+  };
+
+  class MuteScope {
+  private:
+    bool previous;
+
+  public:
+    MuteScope();
+    MuteScope(const MuteScope& other) = delete;
+    MuteScope& operator=(const MuteScope& other) = delete;
+    ~MuteScope(); // destructor
+  };
+
+  static bool isMuted(); // on this thread
+
+private:
+  static thread_local bool muted;
+};
+
+/**
+ * The random generator of the game playing on this thread. A game engine owns its generator and binds it with a
+ * Scope while it plays, so battle rolls, automatic choices and ai search all follow the game's seed. Outside a
+ * game, a per-thread generator seeded from the system is used.
+ */
+class GameRandom {
+public:
+  using Engine = std::mt19937;
+
+  class Scope {
+  private:
+    Engine* previous;
+
+  public:
+    explicit Scope(Engine& rng);
+    Scope(const Scope& other) = delete;
+    Scope& operator=(const Scope& other) = delete;
+    ~Scope(); // destructor, rebinds the generator that was bound before
+  };
+
+  static Engine& get();
+
+private:
+  static thread_local Engine* bound;
+};
+
+/**
+ * How many threads one piece of work may spread over. Pool workers (sweeps, the game server, command batches)
+ * mark themselves with a PoolScope, and work started on them stays on their thread, so nested parallel work
+ * never multiplies into workers x hardware threads.
+ */
+class Parallelism {
+public:
+  class PoolScope {
+  private:
+    bool previous;
+
+  public:
+    PoolScope();
+    PoolScope(const PoolScope& other) = delete;
+    PoolScope& operator=(const PoolScope& other) = delete;
+    ~PoolScope(); // destructor
+  };
+
+  static int available(); // 1 on a pool worker, every hardware thread otherwise
+
+private:
+  static thread_local bool inPool;
+};
+
 class Utility {
 public:
   static std::vector<std::string> findMapFiles(const std::string& dir);
+  static std::string jsonString(const std::string& str); // quoted and escaped json string literal
 };